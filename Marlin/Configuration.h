@@ -3473,6 +3473,7 @@
   #define PROUI_EX 1            // Extended UI features (15152 bytes of flash)
   //#define CV_LASER_MODULE
   #define HAS_GCODE_PREVIEW 1
+  //#define PROUI_PREVIEW_CACHE // Cache G-code preview info in a PREVIEW.IDX file in each folder (writes to the media while browsing)
   #define DISABLE_TUNING_GRAPH 0// PID/MPC Tuning Plot Graph (1624 bytes of flash)
   #define HAS_ESDIAG 1          // View End-stop switch continuity (560 bytes of flash)
   //#define HAS_CGCODE 1        // Extra Gcode options (3320 bytes of flash)
@@ -3485,6 +3486,7 @@
     #define HS_MENU_ITEM        // BLTOUCH_HS_MODE menu option (56 bytes of flash)
   #endif
   #define PROUI_ITEM_PLOT       // Temp Plot Graph item in Tune/Prepare Menu (688 bytes of flash)
+  #define PROUI_TEMP_HISTORY 480 // Temp samples, 0.5s apart, for plot zoom and C994 (2 bytes of RAM each per sensor)
   //#define PROUI_ITEM_PLR      // Power-Loss Recovery option in Tune Menu (POWER_LOSS_RECOVERY 3400 bytes of flash)
   //#define PROUI_ITEM_JD       // Juntion Deviation item in Tune Menu (only if JD is enabled)
   #define PROUI_ITEM_ADVK       // Linear Advance item in Tune Menu (only if LA is enabled)
@@ -195,6 +195,25 @@
 //#define MAX31865_WIRE_OHMS_1              0.0f
 //#define MAX31865_WIRE_OHMS_2              0.0f
 
+/**
+ * Direct Thermistor Lookup
+ * Resample each thermistor table at build time into evenly spaced points indexed
+ * by the top bits of the raw ADC value. Conversion is one multiply-add, with no
+ * table search. Uses (2^THERMISTOR_DIRECT_BITS + 1) * 2 bytes of flash per table.
+ *
+ * The build fails if a resampled table deviates from its source table by more than
+ * THERMISTOR_DIRECT_MAX_ERROR anywhere in the checked temperature range. Increase
+ * THERMISTOR_DIRECT_BITS for steep tables (e.g., 1, 61, 66, 98) or high temperatures.
+ */
+//#define THERMISTOR_DIRECT_LOOKUP
+#if ENABLED(THERMISTOR_DIRECT_LOOKUP)
+  #define THERMISTOR_DIRECT_BITS        10  // (6-12) Table has 2^BITS segments. 10 = one point per 10-bit ADC step.
+  #define THERMISTOR_DIRECT_MAX_ERROR  1.0  // (°C) Largest allowed deviation from the source table
+  #define THERMISTOR_DIRECT_CHECK_MIN    0  // (°C) Range of temperatures to check
+  #define THERMISTOR_DIRECT_CHECK_MAX  300
+  //#define THERMISTOR_DIRECT_USER          // Also resample User Thermistors (1000) into RAM when changed with M305
+#endif
+
 /**
  * Hephestos 2 24V heated bed upgrade kit.
  * https://www.en3dstudios.com/product/bq-hephestos-2-heated-bed-kit/
@@ -1182,6 +1201,7 @@
   #define FTM_MIN_TICKS ((STEPPER_TIMER_RATE) / (FTM_STEPPER_FS)) // Minimum stepper ticks between steps
 
   #define FTM_MIN_SHAPE_FREQ           10         // Minimum shaping frequency
+  #define FTM_DYNFREQ_TOLERANCE         0.1f      // (Hz) Dynamic frequency change needed to recompute the shaper delays
   #define FTM_RATIO (FTM_FS / FTM_MIN_SHAPE_FREQ) // Factor for use in FTM_ZMAX. DON'T CHANGE.
   #define FTM_ZMAX (FTM_RATIO * 2)                // Maximum delays for shaping functions (even numbers only!)
                                                   // Calculate as:
@@ -1741,6 +1761,17 @@
 
   #define SD_PROCEDURE_DEPTH 1              // Increase if you need more nested M32 calls  // MRiscoC save program memory
 
+  /**
+   * Read ahead of the file being printed in whole blocks, and split G-code
+   * lines straight out of the buffer instead of reading one byte at a time.
+   * Blocks are read while the command queue is full, so card latency falls
+   * where the main loop has time to spare. Uses 512 bytes of SRAM per block.
+   */
+  //#define SD_READ_AHEAD
+  #if ENABLED(SD_READ_AHEAD)
+    #define SD_READ_AHEAD_BLOCKS 2          // (2-16) Number of 512 byte blocks to buffer
+  #endif
+
   #define SD_FINISHED_STEPPERRELEASE true   // Disable steppers when SD Print is finished
   #define SD_FINISHED_RELEASECOMMAND "G27P2"  // Use "M84XYE" to keep Z enabled so your bed stays in place
 
@@ -2118,6 +2149,23 @@
   #endif
 #endif // HAS_DGUS_LCD
 
+//
+// Additional options for DWIN E3V2 / ProUI displays
+//
+#if HAS_DWIN_E3V2 || IS_DWIN_MARLINUI
+  /**
+   * Queue DWIN packets in RAM and hand them to the UART in bulk at DWIN_UpdateLCD()
+   * instead of writing (and waiting on) one byte at a time. A full menu redraw
+   * no longer holds up the main loop while the serial port catches up.
+   */
+  #define DWIN_TX_QUEUE
+  #if ENABLED(DWIN_TX_QUEUE)
+    #define DWIN_TX_QUEUE_SIZE 512        // (bytes) Power of 2, 64 or more
+  #endif
+
+  //#define DWIN_TX_STATS                 // Count DWIN packets and bytes sent per second. ProUI reports them with C996.
+#endif
+
 //
 // Additional options for AnyCubic Chiron TFT displays
 //
@@ -2552,6 +2600,23 @@
   //#define CNC_WORKSPACE_PLANES      // Allow G2/G3/G5 to operate in XY, ZX, or YZ planes
 #endif
 
+/**
+ * G1 Segment Coalescing
+ *
+ * Merge runs of tiny G1 moves waiting in the command queue into a single move
+ * when they continue along the same line. High-resolution slicer output then
+ * uses fewer planner blocks and junction calculations, and slow hosts can keep
+ * the planner fed. Only moves with the same feedrate and no parameters other
+ * than axes, E, and F are merged, and extrusion must stay proportional to the
+ * distance moved. Mesh leveling still applies to the merged move.
+ */
+//#define SEGMENT_COALESCING
+#if ENABLED(SEGMENT_COALESCING)
+  #define COALESCE_SEGMENT_MM    0.5  // (mm) Only merge moves shorter than this
+  #define COALESCE_TOLERANCE_MM  0.005 // (mm) Max distance of merged points from the merged line
+  #define COALESCE_MAX_SEGMENTS  8    // Max number of moves merged into one
+#endif
+
 /**
  * Direct Stepping
  *
@@ -2644,6 +2709,17 @@
   #define BLOCK_BUFFER_SIZE 32
 #endif
 
+/**
+ * Planner Health
+ * Track planner underruns during prints, the fewest moves queued ahead of the
+ * steppers, and the time spent in planner recalculation. Use these to tune
+ * BLOCK_BUFFER_SIZE, BUFSIZE and the host's send rate.
+ *   M153           : Report planner health
+ *   M153 S<secs>   : Auto-report planner health every S seconds (S0 to stop)
+ *   M153 R         : Reset the statistics
+ */
+//#define PLANNER_HEALTH
+
 // @section serial
 
 // The ASCII buffer for serial input
@@ -3981,6 +4057,16 @@
 #define FASTER_GCODE_PARSER
 #if ENABLED(FASTER_GCODE_PARSER)
   //#define GCODE_QUOTED_STRINGS  // Support for quoted string parameters
+
+  /**
+   * Convert numeric parameters once, while parsing, instead of on every read.
+   * Speeds up G0/G1 and other commands that read several values.
+   * Spend 30 + 4 * GCODE_VALUE_SLOTS bytes of SRAM.
+   */
+  //#define FASTER_GCODE_VALUES
+  #if ENABLED(FASTER_GCODE_VALUES)
+    #define GCODE_VALUE_SLOTS 8   // Values stored per command. Any more are read from the text.
+  #endif
 #endif
 
 /**
@@ -3989,6 +4075,16 @@
 #define MEATPACK_ON_SERIAL_PORT_1
 //#define MEATPACK_ON_SERIAL_PORT_2
 
+/**
+ * Compact Move Protocol for hosts streaming many short moves over serial.
+ * 'M880 S1' switches the port to binary frames with delta-encoded G0/G1 moves,
+ * which are planned directly, without G-code parsing. Other commands are sent
+ * in G-code frames. Frames carry a sequence number and CRC for resends.
+ * MeatPack packing must be off while the protocol is in use on a port.
+ * Host: buildroot/share/scripts/MarlinCompactMoves.py
+ */
+//#define COMPACT_MOVE_PROTOCOL
+
 //#define GCODE_CASE_INSENSITIVE  // Accept G-code sent to the firmware in lowercase
 
 //#define REPETIER_GCODE_M360     // Add commands originally from Repetier FW
@@ -4682,6 +4778,16 @@
    * To help diagnose print quality issues stemming from empty command buffers.
    */
   //#define BUFFER_MONITORING
+
+  /**
+   * D200 - ISR Timing
+   * Measure the duration of the Stepper and Temperature interrupts to see how
+   * close the board is to saturation with Input Shaping, Linear Advance, etc.
+   * Uses the DWT cycle counter on Cortex-M3/M4/M7 and micros() elsewhere.
+   *   D200   : Report min/avg/max durations and a histogram for each interrupt
+   *   D200 R : Reset the statistics
+   */
+  //#define ISR_TIMING
 #endif
 
 /**
@@ -112,7 +112,7 @@
   #else
     #error "LCD_SERIAL_PORT must be from 1 to 9, or -1 for Native USB."
   #endif
-  #if ANY(HAS_DGUS_LCD, EXTENSIBLE_UI)
+  #if ANY(HAS_DGUS_LCD, EXTENSIBLE_UI, DWIN_TX_QUEUE)
     #define LCD_SERIAL_TX_BUFFER_FREE() LCD_SERIAL.availableForWrite()
   #endif
 #endif
@@ -223,6 +223,10 @@
   #include "feature/fancheck.h"
 #endif
 
+#if ENABLED(PLANNER_HEALTH)
+  #include "feature/planner_health.h"
+#endif
+
 #if ENABLED(USE_CONTROLLER_FAN)
   #include "feature/controllerfan.h"
 #endif
@@ -261,6 +265,14 @@
   #include "tests/marlin_tests.h"
 #endif
 
+#if ENABLED(REPLAY_BENCH)
+  #include "tests/replay_bench.h"
+#endif
+
+#if ENABLED(INGEST_BENCH)
+  #include "tests/ingest_bench.h"
+#endif
+
 #if HAS_RS485_SERIAL
   #include "feature/rs485.h"
 #endif
@@ -846,6 +858,7 @@ void idle(const bool no_stepper_sleep/*=false*/) {
       TERN_(AUTO_REPORT_FANS, fan_check.auto_reporter.tick());
       TERN_(AUTO_REPORT_SD_STATUS, card.auto_reporter.tick());
       TERN_(AUTO_REPORT_POSITION, position_auto_reporter.tick());
+      TERN_(PLANNER_HEALTH, plannerHealth.auto_reporter.tick());
       TERN_(BUFFER_MONITORING, queue.auto_report_buffer_statistics());
     }
   #endif
@@ -874,6 +887,9 @@ void idle(const bool no_stepper_sleep/*=false*/) {
   // Manage Fixed-time Motion Control
   TERN_(FT_MOTION, ftMotion.loop());
 
+  // Run the Stepper on simulated time for the replay benchmark
+  TERN_(REPLAY_BENCH, replayBench.idle());
+
   IDLE_DONE:
   TERN_(MARLIN_DEV_MODE, idle_depth--);
 
@@ -1679,6 +1695,9 @@ void setup() {
   SETUP_LOG("setup() completed.");
 
   TERN_(MARLIN_TEST_BUILD, runStartupTests());
+
+  TERN_(REPLAY_BENCH, replayBench.run());
+  TERN_(INGEST_BENCH, ingest_bench_run());
 }
 
 /**
@@ -0,0 +1,325 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2020 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "../inc/MarlinConfig.h"
+
+#if ENABLED(COMPACT_MOVE_PROTOCOL)
+
+#include "compact_moves.h"
+#include "../gcode/gcode.h"
+#include "../gcode/queue.h"
+#include "../module/motion.h"
+#include "../module/planner.h"
+#include "../libs/crc16.h"
+#include "../MarlinCore.h"
+
+#if ENABLED(CANCEL_OBJECTS)
+  #include "cancel_object.h"
+#endif
+
+#if ENABLED(PRINTCOUNTER)
+  #include "../module/printcounter.h"
+#endif
+
+CompactMoves compactMoves;
+
+bool CompactMoves::active; // = false
+serial_index_t CompactMoves::port;
+CompactMoves::State CompactMoves::state; // = WAIT_START
+bool CompactMoves::frame_ready, CompactMoves::resend_sent, CompactMoves::resync, CompactMoves::e_known;
+uint8_t CompactMoves::next_seq, CompactMoves::count, CompactMoves::escape_match;
+uint8_t CompactMoves::frame[3 + MAX_DATA + 2];
+millis_t CompactMoves::resend_ms;
+int32_t CompactMoves::pos[XYZ];
+int64_t CompactMoves::e_pos;
+
+void CompactMoves::start(const serial_index_t p) {
+  port = p;
+  state = State::WAIT_START;
+  frame_ready = resend_sent = false;
+  resync = true;
+  next_seq = 0;
+  escape_match = 0;
+  active = true;
+}
+
+void CompactMoves::stop() {
+  active = frame_ready = false;
+}
+
+void CompactMoves::report() {
+  SERIAL_ECHOPGM("Compact Moves ");
+  serialprint_onoff(active);
+  SERIAL_EOL();
+}
+
+void CompactMoves::request_resend() {
+  // Frames sent before the host saw "rs" are expected to be dropped.
+  // Ask again after a while in case the "rs" or the resent frame was lost.
+  // Also called from receive() to repeat the "rs" while no frames arrive.
+  const millis_t ms = millis();
+  if (resend_sent && PENDING(ms, resend_ms)) return;
+  resend_sent = true;
+  resend_ms = ms + RESEND_MS;
+  PORT_REDIRECT(SERIAL_PORTMASK(port));
+  SERIAL_ECHOLNPGM("rs", next_seq);
+}
+
+/**
+ * Check a complete frame and decide what to do with it
+ */
+void CompactMoves::frame_done() {
+  const uint8_t len = frame[2];
+  uint16_t crc = 0;
+  crc16(&crc, frame, 3 + len);
+  if (frame[3 + len] != (crc & 0xFF) || frame[3 + len + 1] != (crc >> 8))
+    return request_resend();     // Corrupt
+
+  const int8_t ahead = int8_t(frame[0] - next_seq);
+  if (ahead == 0) {
+    resend_sent = false;
+    frame_ready = true;          // Run it from advance()
+  }
+  else if (ahead < 0) {          // Sent again after a lost "ok"
+    PORT_REDIRECT(SERIAL_PORTMASK(port));
+    SERIAL_ECHOLNPGM("ok", uint8_t(next_seq - 1));
+  }
+  else
+    request_resend();            // One or more frames were lost
+}
+
+bool CompactMoves::receive() {
+  if (resend_sent && !frame_ready) request_resend();
+
+  bool had_data = false;
+  while (!frame_ready && SERIAL_IMPL.available(port) > 0) {
+    const int r = SERIAL_IMPL.read(port);
+    if (r < 0) break;
+    had_data = true;
+    uint8_t c = uint8_t(r);
+    bool bad = false;
+
+    if (c == FRAME_START) {
+      if (state != State::WAIT_START) request_resend(); // Cut short
+      state = State::FRAME;
+      count = 0;
+      continue;
+    }
+
+    switch (state) {
+      case State::WAIT_START: {
+        // Leave on a plain "M880 S0" line
+        static const char escape_line[] PROGMEM = "M880 S0";
+        if (ISEOL(c)) {
+          if (escape_match == COUNT(escape_line) - 1) {
+            stop();
+            PORT_REDIRECT(SERIAL_PORTMASK(port));
+            report();
+            SERIAL_ECHOLNPGM(STR_OK);
+            return true;
+          }
+          escape_match = 0;
+        }
+        else if (escape_match < COUNT(escape_line) - 1 && c == pgm_read_byte(&escape_line[escape_match]))
+          escape_match++;
+        else
+          escape_match = 0;
+      } continue;
+
+      case State::ESCAPE:
+        c ^= ESCAPE_XOR;
+        bad = c < FRAME_ESCAPE && !ISEOL(c);
+        state = State::FRAME;
+        break;
+
+      case State::FRAME:
+        if (c == FRAME_ESCAPE) { state = State::ESCAPE; continue; }
+        bad = c > FRAME_START || ISEOL(c); // 0xFF and line ends are never sent unescaped
+        break;
+    }
+
+    if (bad || count >= COUNT(frame) || (count > 2 && frame[2] > MAX_DATA)) {
+      state = State::WAIT_START; // Not a valid frame
+      request_resend();
+      continue;
+    }
+
+    frame[count++] = c;
+    if (count > 2 && count == 3 + frame[2] + 2) {
+      state = State::WAIT_START;
+      frame_done();
+    }
+  }
+  return had_data;
+}
+
+// Read an unsigned LEB128 varint, returning false on a short frame or a value too big for T
+template<typename T>
+static bool read_varint(const uint8_t * &p, const uint8_t * const end, T &v) {
+  constexpr uint8_t bits = sizeof(T) * 8;
+  v = 0;
+  for (uint8_t shift = 0; shift < bits; shift += 7) {
+    if (p >= end) return false;
+    const uint8_t b = *p++;
+    if (shift + 7 > bits && ((b & 0x7F) >> (bits - shift))) return false;
+    v |= T(b & 0x7F) << shift;
+    if (!(b & 0x80)) return true;
+  }
+  return false;
+}
+
+/**
+ * Plan a move the way G0/G1 would for the same parameters.
+ * Positions are divided by their scale, so they get the same floats as the G-code text.
+ * (Exact up to 2^24 units: 16m for X, Y, Z and 167mm for an E position. Beyond that
+ * they may differ by one float step.) E is 64-bit since M82 prints can pass 21m.
+ */
+void CompactMoves::move(const uint8_t type, const uint8_t *data, const uint8_t len) {
+  const uint8_t * const end = data + len;
+  uint32_t v[FIELD_F + 1] = { 0 };
+  uint64_t ve = 0;
+  bool ok = true;
+  for (uint8_t f = FIELD_X; ok && f <= FIELD_F; ++f)
+    if (TEST(type, f)) ok = f == FIELD_E ? read_varint(data, end, ve) : read_varint(data, end, v[f]);
+  if (!ok || data != end) {
+    SERIAL_ERROR_MSG("Bad compact move");
+    return;
+  }
+
+  if (!MOTION_CONDITIONS) { resync = true; return; }
+
+  auto zigzag = [](const uint32_t u) { return int32_t(u >> 1) ^ -int32_t(u & 1); };
+
+  if (resync) {
+    resync = e_known = false;
+    for (uint8_t i = 0; i < _MIN(NUM_AXES, XYZ); ++i)
+      pos[i] = LROUND(NATIVE_TO_LOGICAL(current_position[i], i) * XYZ_SCALE);
+  }
+
+  #if ENABLED(CANCEL_OBJECTS)
+    const bool &skip_move = cancelable.skipping;
+  #else
+    constexpr bool skip_move = false;
+  #endif
+
+  destination = current_position;
+  for (uint8_t i = 0; i < _MIN(NUM_AXES, XYZ); ++i) {
+    if (!TEST(type, i)) continue;
+    pos[i] = TEST(type, ABSOLUTE_XYZ) ? zigzag(v[i]) : pos[i] + zigzag(v[i]);
+    if (!skip_move) destination[i] = LOGICAL_TO_NATIVE(pos[i] / float(XYZ_SCALE), i);
+  }
+
+  #if HAS_EXTRUDERS
+    if (TEST(type, FIELD_E)) {
+      const int64_t e = int64_t(ve >> 1) ^ -int64_t(ve & 1);
+      if (TEST(type, ABSOLUTE_E) || e_known) {
+        e_pos = TEST(type, ABSOLUTE_E) ? e : e_pos + e;
+        e_known = true;
+        destination.e = e_pos / float(E_SCALE);
+      }
+      else
+        destination.e += e / float(E_SCALE); // Relative extrusion, as G1 adds it
+    }
+    #if ENABLED(PRINTCOUNTER)
+      if (!DEBUGGING(DRYRUN) && !skip_move)
+        print_job_timer.incFilamentUsed(destination.e - current_position.e);
+    #endif
+  #endif
+
+  #if HAS_FAST_MOVES
+    const bool fast_move = TEST(type, RAPID);
+  #endif
+
+  #ifdef G0_FEEDRATE
+    feedRate_t old_feedrate;
+    #if ENABLED(VARIABLE_G0_FEEDRATE)
+      if (fast_move) {
+        old_feedrate = feedrate_mm_s;             // Back up the (old) motion mode feedrate
+        feedrate_mm_s = fast_move_feedrate;       // Get G0 feedrate from last usage
+      }
+    #endif
+  #endif
+
+  if (TEST(type, FIELD_F) && v[FIELD_F]) feedrate_mm_s = MMM_TO_MMS(v[FIELD_F]);
+
+  #ifdef G0_FEEDRATE
+    if (fast_move) {
+      #if ENABLED(VARIABLE_G0_FEEDRATE)
+        fast_move_feedrate = feedrate_mm_s;       // Save feedrate for the next G0
+      #else
+        old_feedrate = feedrate_mm_s;             // Back up the (new) motion mode feedrate
+        feedrate_mm_s = MMM_TO_MMS(G0_FEEDRATE);  // Get the fixed G0 feedrate
+      #endif
+    }
+  #endif
+
+  #if ANY(IS_SCARA, POLAR)
+    fast_move ? prepare_fast_move_to_destination() : prepare_line_to_destination();
+  #else
+    prepare_line_to_destination();
+  #endif
+
+  #ifdef G0_FEEDRATE
+    if (fast_move) feedrate_mm_s = old_feedrate;  // Restore the motion mode feedrate
+  #endif
+}
+
+void CompactMoves::advance() {
+  if (!frame_ready) return;
+
+  const uint8_t seq = frame[0], type = frame[1], len = frame[2];
+  const uint8_t * const data = &frame[3];
+
+  if ((type & FIELDS) && planner.is_full()) return; // Wait for room to plan the move
+
+  PORT_REDIRECT(SERIAL_PORTMASK(port));
+
+  if (type & FIELDS)
+    move(type, data, len);
+  else switch (type) {
+    case QUERY:
+      SERIAL_ECHOLNPGM("cm", COMPACT_MOVE_VERSION, ",", MAX_DATA);
+      break;
+
+    case GCODE: {
+      char cmd[MAX_CMD_SIZE];
+      memcpy(cmd, data, len);
+      cmd[len] = '\0';
+      queue.ring_buffer.enqueue(cmd, true OPTARG(HAS_MULTI_SERIAL, port)); // Ring is empty. "ok" is sent below.
+      resync = true;               // The command may move or set the position
+    } break;
+
+    case EXIT:
+      stop();
+      break;
+
+    default:
+      SERIAL_ERROR_MSG("Unknown compact frame ", type);
+      break;
+  }
+
+  frame_ready = false;
+  next_seq = seq + 1;
+  SERIAL_ECHOLNPGM("ok", seq);
+}
+
+#endif // COMPACT_MOVE_PROTOCOL
@@ -0,0 +1,131 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2020 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+#pragma once
+
+/**
+ * Compact Move Protocol
+ *
+ * After 'M880 S1' the serial port that sent it reads binary frames instead of G-code lines.
+ * Move frames go to the planner directly, without the command queue or the G-code parser.
+ *
+ * Frame:  START SEQ TYPE LEN DATA[LEN] CRC_LO CRC_HI
+ *
+ *   START  0xFE. Never appears elsewhere, so a receiver can always find the next frame.
+ *   SEQ    Sequence number, starting at 0 after M880 S1 and wrapping at 255.
+ *   TYPE   Move bits or a control code (below).
+ *   LEN    Length of DATA.
+ *   CRC    CRC-16/XMODEM of SEQ, TYPE, LEN, and DATA.
+ *
+ *   Every byte after START that is 0xFD or higher, '\n' or '\r' is sent as 0xFD followed by the
+ *   byte XOR 0x20. This keeps 0xFE out of the frame and 0xFF out of the stream, so MeatPack (with
+ *   packing off) passes frames through unchanged. With no line ends in a frame, the emergency
+ *   parser ignores it from the START byte up to the next line end.
+ *
+ * Move (any of TYPE bits 0-4 set):
+ *   Bits 0-4 flag the fields that follow in DATA, in order: X Y Z E F.
+ *   X, Y, Z: Zigzag varint in microns. A change from the last move, or a logical position if bit 5 is set.
+ *   E:       Zigzag varint in 1/100000 mm, up to 64 bits. A position if bit 6 is set. Otherwise a change from the
+ *            last E position sent, or from the current E if none was sent since the last resync.
+ *   F:       Varint feedrate in mm/min.
+ *   Bit 7 marks a G0 move.
+ *
+ * Control (TYPE bits 0-4 clear):
+ *   0x00 QUERY: Reply "cm<version>,<max data length>"
+ *   0x20 GCODE: DATA is a G-code line to run in order with the moves. It gets no "ok" of its own.
+ *   0x40 EXIT:  Return to G-code lines.
+ *
+ * Replies:
+ *   "ok<seq>"   The frame was run (or queued). Also sent for a repeated frame that was already run.
+ *   "rs<seq>"   A frame was corrupt or missing. Send again from <seq>. Later frames are dropped until then.
+ *               Repeated every RESEND_MS until the frame arrives.
+ *
+ * The host should also send the oldest unacknowledged frame again if no reply comes
+ * for a while, in case an "ok" was lost. A frame that already ran gets its "ok" again.
+ * Frames aren't read during a long command, so wait longer after each try with no reply.
+ *
+ * Frames wait for the command queue to empty, so moves keep their place after G-code frames.
+ * The host should keep no more unacknowledged bytes in flight than the serial RX buffer holds.
+ *
+ * Positions are read from the machine when the protocol starts and after every G-code frame.
+ * Send X, Y, and Z as positions (bit 5) for the first move after these, and E as a position
+ * (bit 6) if later changes are meant to be from it (M82) rather than added to the current E (M83).
+ *
+ * Sending "M880 S0" as a plain G-code line also leaves the protocol, e.g., after the host reconnects.
+ * M108, M112, M410, M876 etc. still work as plain lines between frames. Start them with a line end,
+ * e.g., "\nM108\n", so the emergency parser stops ignoring the preceding frame.
+ *
+ * See buildroot/share/scripts/MarlinCompactMoves.py for a host implementation.
+ */
+
+#include "../inc/MarlinConfig.h"
+
+#define COMPACT_MOVE_VERSION 1
+
+class CompactMoves {
+public:
+  enum Field : uint8_t { FIELD_X, FIELD_Y, FIELD_Z, FIELD_E, FIELD_F, ABSOLUTE_XYZ, ABSOLUTE_E, RAPID };
+  enum Control : uint8_t { QUERY = 0x00, GCODE = 0x20, EXIT = 0x40 };
+  static constexpr uint8_t FIELDS = 0x1F;
+
+  static constexpr uint8_t FRAME_START = 0xFE, FRAME_ESCAPE = 0xFD, ESCAPE_XOR = 0x20,
+                           MAX_DATA = MAX_CMD_SIZE - 1;    // G-code frames must fit a command line
+  static constexpr int32_t XYZ_SCALE = 1000, E_SCALE = 100000; // Units per mm
+  static constexpr millis_t RESEND_MS = 500;                    // Time before "rs" is repeated
+
+  static bool active;
+  static serial_index_t port;
+
+  static void start(const serial_index_t p);
+  static void stop();
+  static void report();
+
+  // The protocol owns this serial port
+  static bool owns_port(const serial_index_t p) { return active && port.index == p.index; }
+
+  // Read the port until a frame is complete. Return true if there was data.
+  static bool receive();
+
+  // Run a received frame, if moves can be planned. Called when the command queue is empty.
+  static void advance();
+
+private:
+  enum class State : uint8_t { WAIT_START, FRAME, ESCAPE };
+
+  static State state;
+  static bool frame_ready,   // A valid frame is waiting to run
+              resend_sent,   // Dropping frames until the requested one arrives
+              resync,        // Read positions from the machine before the next move
+              e_known;       // e_pos holds the last E position sent
+  static uint8_t next_seq,   // Sequence number of the next frame to run
+                 count,      // Bytes received after START
+                 escape_match; // Characters of "M880 S0" received outside frames
+  static uint8_t frame[3 + MAX_DATA + 2]; // SEQ TYPE LEN DATA CRC
+  static millis_t resend_ms; // Time when "rs" may be sent again
+  static int32_t pos[XYZ];   // Logical position of the last move, in 1/XYZ_SCALE mm
+  static int64_t e_pos;      // E position of the last move, in 1/E_SCALE mm
+
+  static void frame_done();
+  static void request_resend();
+  static void move(const uint8_t type, const uint8_t *data, const uint8_t len);
+};
+
+extern CompactMoves compactMoves;
@@ -0,0 +1,77 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2024 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+/**
+ * isr_timing.cpp - Duration statistics for the Stepper and Temperature interrupts
+ */
+
+#include "../inc/MarlinConfig.h"
+
+#if ENABLED(ISR_TIMING)
+
+#include "isr_timing.h"
+
+ISRTiming isrTiming;
+
+ISRTiming::stats_t ISRTiming::stats[ISR_COUNT];
+
+void ISRTiming::reset() {
+  hal.isr_off();
+  for (stats_t &s : stats) s = stats_t();
+  hal.isr_on();
+}
+
+/**
+ * Report the statistics for each interrupt, e.g.:
+ *   Stepper calls:51234 min:1.2 avg:3.4 max:18.9us hist:0 8 51002 210 14 0 0 0
+ *
+ * Durations of an interrupt include any nested interrupts, and the Stepper
+ * ISR includes its pulse and block phases.
+ */
+void ISRTiming::report() {
+  static PGMSTR(str_stepper, "Stepper");
+  static PGMSTR(str_pulse, "Pulse phase");
+  static PGMSTR(str_block, "Block phase");
+  static PGMSTR(str_temperature, "Temperature");
+  static PGM_P const names[ISR_COUNT] PROGMEM = { str_stepper, str_pulse, str_block, str_temperature };
+
+  for (uint8_t i = 0; i < ISR_COUNT; ++i) {
+    hal.isr_off();
+    const stats_t s = stats[i];
+    hal.isr_on();
+
+    SERIAL_ECHOPGM_P((PGM_P)pgm_read_ptr(&names[i]));
+    SERIAL_ECHOPGM(" calls:", s.count);
+    if (s.count) {
+      const float us_per_tick = 1.0f / (ISR_TIMING_TICKS_PER_US);
+      SERIAL_ECHOPGM(
+        " min:", p_float_t(s.min_ticks * us_per_tick, 2),
+        " avg:", p_float_t(float(s.total_ticks) / s.count * us_per_tick, 2),
+        " max:", p_float_t(s.max_ticks * us_per_tick, 2), "us hist:"
+      );
+      for (const uint32_t h : s.histogram) SERIAL_ECHO(C(' '), h);
+    }
+    SERIAL_EOL();
+  }
+}
+
+#endif // ISR_TIMING
@@ -0,0 +1,77 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2024 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+#pragma once
+
+/**
+ * isr_timing.h - Duration statistics for the Stepper and Temperature interrupts
+ */
+
+#include "../inc/MarlinConfig.h"
+
+// Cortex-M3/M4/M7 count CPU cycles with DWT CYCCNT, enabled by calibrate_delay_loop().
+// Other CPUs fall back to micros().
+#if defined(__ARM_ARCH_7M__) || defined(__ARM_ARCH_7EM__)
+  #define ISR_TIMING_TICKS()      (*(volatile uint32_t *)0xE0001004) // DWT_CYCCNT
+  #define ISR_TIMING_TICKS_PER_US ((F_CPU) / 1000000UL)
+#else
+  #define ISR_TIMING_TICKS()      micros()
+  #define ISR_TIMING_TICKS_PER_US 1UL
+#endif
+
+#define ISR_TIMING_BUCKETS 8 // <1, <2, <4, ... <64, >=64µs
+
+class ISRTiming {
+public:
+  enum ISRIndex : uint8_t { STEPPER, PULSE_PHASE, BLOCK_PHASE, TEMPERATURE, ISR_COUNT };
+
+  typedef struct {
+    uint32_t count, min_ticks, max_ticks;
+    uint64_t total_ticks;
+    uint32_t histogram[ISR_TIMING_BUCKETS]; // Calls by duration, doubling from 1µs
+  } stats_t;
+
+  static stats_t stats[ISR_COUNT];
+
+  static void reset();
+  static void report();
+
+  static void record(const ISRIndex isr, const uint32_t ticks) {
+    stats_t &s = stats[isr];
+    if (!s.count++ || ticks < s.min_ticks) s.min_ticks = ticks;
+    s.total_ticks += ticks;
+    NOLESS(s.max_ticks, ticks);
+    uint8_t b = 0;
+    for (uint32_t us = ticks / ISR_TIMING_TICKS_PER_US; us && b < ISR_TIMING_BUCKETS - 1; us >>= 1) ++b;
+    s.histogram[b]++;
+  }
+};
+
+extern ISRTiming isrTiming;
+
+// Record the time from construction to the end of the scope
+class ISRTimingScope {
+  const ISRTiming::ISRIndex isr;
+  const uint32_t start;
+public:
+  ISRTimingScope(const ISRTiming::ISRIndex i) : isr(i), start(ISR_TIMING_TICKS()) {}
+  ~ISRTimingScope() { ISRTiming::record(isr, ISR_TIMING_TICKS() - start); }
+};
@@ -0,0 +1,69 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2024 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+/**
+ * planner_health.cpp - Track how well the planner keeps ahead of the steppers
+ */
+
+#include "../inc/MarlinConfig.h"
+
+#if ENABLED(PLANNER_HEALTH)
+
+#include "planner_health.h"
+#include "../MarlinCore.h"
+#include "../module/planner.h"
+
+PlannerHealth plannerHealth;
+
+uint32_t PlannerHealth::underruns, PlannerHealth::recalcs, PlannerHealth::recalc_us, PlannerHealth::recalc_max_us;
+uint8_t PlannerHealth::min_queued = UINT8_MAX;
+AutoReporter<PlannerHealth::AutoReportPlanner> PlannerHealth::auto_reporter;
+
+void PlannerHealth::reset() {
+  underruns = recalcs = recalc_us = recalc_max_us = 0;
+  min_queued = UINT8_MAX;
+}
+
+void PlannerHealth::block_added(const uint8_t queued) {
+  if (!printingIsActive()) return;
+  // The steppers ran out of moves before this one arrived
+  if (!queued) underruns++;
+  NOMORE(min_queued, queued);
+}
+
+/**
+ * Report the planner statistics, e.g.:
+ *   Planner underruns:2 min queued:3/15 recalc avg:41us max:180us spare blocks:120
+ *
+ * "spare blocks" is how many more blocks would fit in the free RAM,
+ * as a hint for raising BLOCK_BUFFER_SIZE.
+ */
+void PlannerHealth::report() {
+  SERIAL_ECHOPGM("Planner underruns:", underruns, " min queued:");
+  if (min_queued == UINT8_MAX) SERIAL_CHAR('-'); else SERIAL_ECHO(min_queued);
+  SERIAL_ECHOLNPGM("/", (BLOCK_BUFFER_SIZE) - 1,
+    " recalc avg:", recalcs ? recalc_us / recalcs : 0, "us max:", recalc_max_us, "us"
+    " spare blocks:", _MAX(0, hal.freeMemory()) / int(sizeof(block_t))
+  );
+}
+
+#endif // PLANNER_HEALTH
@@ -0,0 +1,54 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2024 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+#pragma once
+
+/**
+ * planner_health.h - Track how well the planner keeps ahead of the steppers
+ */
+
+#include "../inc/MarlinConfig.h"
+#include "../libs/autoreport.h"
+
+class PlannerHealth {
+public:
+  static uint32_t underruns;      // Moves queued into an empty planner during a print
+  static uint8_t min_queued;      // Fewest moves already queued when a move was added during a print
+  static uint32_t recalcs,        // Calls to Planner::recalculate
+                  recalc_us,      // Total time spent in Planner::recalculate
+                  recalc_max_us;  // Longest time spent in Planner::recalculate
+
+  static void reset();
+  static void report();
+
+  // Called by the planner for each move, with the number of moves queued before it
+  static void block_added(const uint8_t queued);
+  static void recalculated(const uint32_t us) {
+    recalcs++;
+    recalc_us += us;
+    NOLESS(recalc_max_us, us);
+  }
+
+  struct AutoReportPlanner { static void report() { PlannerHealth::report(); } };
+  static AutoReporter<AutoReportPlanner> auto_reporter;
+};
+
+extern PlannerHealth plannerHealth;
@@ -115,6 +115,8 @@ void say_shaping() {
     #endif
   }
 
+  SERIAL_ECHOLN(ftMotion.cfg.sCurveEna ? F("S-curve") : F("Trapezoidal"), F(" acceleration."));
+
   #if HAS_EXTRUDERS
     SERIAL_ECHO_TERNARY(ftMotion.cfg.linearAdvEna, "Linear Advance ", "en", "dis", "abled");
     if (ftMotion.cfg.linearAdvEna)
@@ -129,7 +131,7 @@ void GcodeSuite::M493_report(const bool forReplay/*=true*/) {
 
   report_heading_etc(forReplay, F(STR_FT_MOTION));
   const ft_config_t &c = ftMotion.cfg;
-  SERIAL_ECHOPGM("  M493 S", c.active);
+  SERIAL_ECHOPGM("  M493 S", c.active, " C", c.sCurveEna);
   #if HAS_X_AXIS
     SERIAL_ECHOPGM(" A", c.baseFreq.x);
     #if HAS_Y_AXIS
@@ -170,6 +172,8 @@ void GcodeSuite::M493_report(const bool forReplay/*=true*/) {
  *       7: 3HEI  : 3-Hump Extra-Intensive
  *       8: MZV   : Mass-based Zero Vibration
  *
+ *    C<bool> Enable (1) or Disable (0) S-curve (jerk-limited) acceleration
+ *
  *    P<bool> Enable (1) or Disable (0) Linear Advance pressure control
  *
  *    K<gain> Set Linear Advance gain
@@ -205,6 +209,12 @@ void GcodeSuite::M493() {
     }
   }
 
+  // Parse 'C' S-curve acceleration parameter.
+  if (parser.seen('C')) {
+    ftMotion.cfg.sCurveEna = parser.value_bool();
+    flag.report = true;
+  }
+
   #if HAS_X_AXIS
     auto set_shaper = [&](const AxisEnum axis, const char c) {
       const ftMotionShaper_t newsh = (ftMotionShaper_t)parser.value_byte();
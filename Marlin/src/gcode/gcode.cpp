@@ -725,6 +725,10 @@ void GcodeSuite::process_parsed_command(const bool no_ok/*=false*/) {
         case 150: M150(); break;                                  // M150: Set Status LED Color
       #endif
 
+      #if ENABLED(PLANNER_HEALTH)
+        case 153: M153(); break;                                  // M153: Report planner health
+      #endif
+
       #if ENABLED(MIXING_EXTRUDER)
         case 163: M163(); break;                                  // M163: Set a component weight for mixing extruder
         case 164: M164(); break;                                  // M164: Save current mix as a virtual extruder
@@ -1041,6 +1045,10 @@ void GcodeSuite::process_parsed_command(const bool no_ok/*=false*/) {
         case 871: M871(); break;                                  // M871: Print/reset/clear first layer temperature offset values
       #endif
 
+      #if ENABLED(COMPACT_MOVE_PROTOCOL)
+        case 880: M880(); break;                                  // M880: Start/stop the Compact Move Protocol
+      #endif
+
       #if ENABLED(LIN_ADVANCE)
         case 900: M900(); break;                                  // M900: Set advance K factor.
       #endif
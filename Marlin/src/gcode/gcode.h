@@ -172,6 +172,7 @@
  * M145 - Set heatup values for materials on the LCD. H<hotend> B<bed> F<fan speed> for S<material> (0=PLA, 1=ABS)
  * M149 - Set temperature units. (Requires TEMPERATURE_UNITS_SUPPORT)
  * M150 - Set Status LED Color as R<red> U<green> B<blue> W<white> P<bright>. Values 0-255. (Requires BLINKM, RGB_LED, RGBW_LED, NEOPIXEL_LED, PCA9533, or PCA9632).
+ * M153 - Report planner health, or auto-report with interval of S<seconds>. R to reset. (Requires PLANNER_HEALTH)
  * M154 - Auto-report position with interval of S<seconds>. (Requires AUTO_REPORT_POSITION)
  * M155 - Auto-report temperatures with interval of S<seconds>. (Requires AUTO_REPORT_TEMPERATURES)
  * M163 - Set a single proportion for a mixing extruder. (Requires MIXING_EXTRUDER)
@@ -299,6 +300,7 @@
  *
  * M871 - Print/reset/clear first layer temperature offset values. (Requires PTC_PROBE, PTC_BED, or PTC_HOTEND)
  * M876 - Handle Prompt Response. (Requires HOST_PROMPT_SUPPORT and not EMERGENCY_PARSER)
+ * M880 - Start or stop the Compact Move Protocol on this serial port. (Requires COMPACT_MOVE_PROTOCOL)
  * M900 - Get or Set Linear Advance K-factor. (Requires LIN_ADVANCE)
  * M906 - Set or get motor current in milliamps using axis codes XYZE, etc. Report values if no axis codes given. (Requires at least one _DRIVER_TYPE defined as TMC2130/2160/5130/5160/2208/2209/2660)
  * M907 - Set digital trimpot motor current using axis codes. (Requires a board with digital trimpots)
@@ -350,6 +352,10 @@
   #define HAS_FAST_MOVES 1
 #endif
 
+#if ENABLED(VARIABLE_G0_FEEDRATE)
+  extern feedRate_t fast_move_feedrate;
+#endif
+
 #if ENABLED(MARLIN_SMALL_BUILD)
   #define GCODE_ERR_MSG(V...) "?"
 #else
@@ -848,6 +854,10 @@ private:
     static void M150();
   #endif
 
+  #if ENABLED(PLANNER_HEALTH)
+    static void M153();
+  #endif
+
   #if ENABLED(AUTO_REPORT_POSITION)
     static void M154();
   #endif
@@ -1219,6 +1229,10 @@ private:
     static void M871();
   #endif
 
+  #if ENABLED(COMPACT_MOVE_PROTOCOL)
+    static void M880();
+  #endif
+
   #if ENABLED(LIN_ADVANCE)
     static void M900();
     static void M900_report(const bool forReplay=true);
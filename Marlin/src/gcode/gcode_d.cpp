@@ -30,6 +30,10 @@
   #include "queue.h"
 #endif
 
+#if ENABLED(ISR_TIMING)
+  #include "../feature/isr_timing.h"
+#endif
+
 #include "../module/settings.h"
 #include "../module/temperature.h"
 #include "../libs/hex_print.h"
@@ -245,6 +249,15 @@ void GcodeSuite::D(const int16_t dcode) {
 
     #endif // HAS_MEDIA
 
+    #if ENABLED(ISR_TIMING)
+      case 200: // D200 Report ISR timing, R to reset
+        if (parser.seen_test('R'))
+          isrTiming.reset();
+        else
+          isrTiming.report();
+        break;
+    #endif
+
     #if ENABLED(POSTMORTEM_DEBUGGING)
 
       case 451: { // Trigger all kind of faults to test exception catcher
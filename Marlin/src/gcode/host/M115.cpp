@@ -134,6 +134,9 @@ void GcodeSuite::M115() {
     cap_line(F("BINARY_FILE_TRANSFER"), ENABLED(BINARY_FILE_TRANSFER));
     /// TODO: Use SERIAL_IMPL.has_feature(port, SerialFeature::BinaryFileTransfer) once implemented
 
+    // COMPACT_MOVES (M880)
+    cap_line(F("COMPACT_MOVES"), ENABLED(COMPACT_MOVE_PROTOCOL));
+
     // EEPROM (M500, M501)
     cap_line(F("EEPROM"), ENABLED(EEPROM_SETTINGS));
 
@@ -0,0 +1,47 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2024 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "../../inc/MarlinConfigPre.h"
+
+#if ENABLED(PLANNER_HEALTH)
+
+#include "../gcode.h"
+#include "../../feature/planner_health.h"
+
+/**
+ * M153: Report planner health
+ *
+ *  S<seconds> - Set the auto-report interval. S0 to stop.
+ *  R          - Reset the statistics
+ */
+void GcodeSuite::M153() {
+
+  if (parser.seen('R')) plannerHealth.reset();
+
+  if (parser.seenval('S'))
+    plannerHealth.auto_reporter.set_interval(parser.value_byte());
+  else if (!parser.seen('R'))
+    plannerHealth.report();
+
+}
+
+#endif // PLANNER_HEALTH
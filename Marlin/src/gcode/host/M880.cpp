@@ -0,0 +1,51 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2020 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "../../inc/MarlinConfig.h"
+
+#if ENABLED(COMPACT_MOVE_PROTOCOL)
+
+#include "../gcode.h"
+#include "../queue.h"
+#include "../../feature/compact_moves.h"
+
+/**
+ * M880: Start or stop the Compact Move Protocol
+ *
+ *   S1 Read compact move frames on this serial port, starting after the "ok"
+ *   S0 Return to G-code lines (also accepted in a G-code frame)
+ *
+ *   With no parameters, report the protocol state.
+ *
+ * See feature/compact_moves.h for the frame format.
+ */
+void GcodeSuite::M880() {
+  if (parser.seenval('S')) {
+    if (parser.value_bool())
+      compactMoves.start(queue.ring_buffer.command_port());
+    else
+      compactMoves.stop();
+  }
+  compactMoves.report();
+}
+
+#endif // COMPACT_MOVE_PROTOCOL
@@ -35,12 +35,144 @@
   #include "../../module/planner.h"
 #endif
 
+#if ENABLED(SEGMENT_COALESCING)
+  #include "../queue.h"
+  #if ENABLED(PRINTCOUNTER)
+    #include "../../module/printcounter.h"
+  #endif
+  #if ENABLED(POWER_LOSS_RECOVERY)
+    #include "../../feature/powerloss.h"
+  #endif
+  #if ENABLED(CANCEL_OBJECTS)
+    #include "../../feature/cancel_object.h"
+  #endif
+#endif
+
 extern xyze_pos_t destination;
 
 #if ENABLED(VARIABLE_G0_FEEDRATE)
   feedRate_t fast_move_feedrate = MMM_TO_MMS(G0_FEEDRATE);
 #endif
 
+#if ENABLED(SEGMENT_COALESCING)
+
+  /**
+   * Check that the points between 'start' and 'end' stay within COALESCE_TOLERANCE_MM
+   * of the line joining them, in order, and that the extruder keeps pace with them.
+   */
+  static bool points_on_line(const xyze_pos_t &start, const xyze_pos_t &end, const xyze_pos_t points[], const uint8_t count) {
+    xyz_float_t dir;
+    float len_sq = 0;
+    LOOP_NUM_AXES(i) { dir[i] = end[i] - start[i]; len_sq += sq(dir[i]); }
+    if (!len_sq) return false;
+    const float len = SQRT(len_sq), inv_len = RECIPROCAL(len);
+    LOOP_NUM_AXES(i) dir[i] *= inv_len;
+
+    #if HAS_EXTRUDERS
+      const float e_per_mm = (end.e - start.e) * inv_len,
+                  e_tolerance = COALESCE_TOLERANCE_MM * ABS(e_per_mm) + 0.001f; // Allow for float rounding of large E
+    #endif
+
+    float prev_along = 0;
+    for (uint8_t p = 0; p < count; ++p) {
+      float along = 0, dist_sq = 0;
+      LOOP_NUM_AXES(i) {
+        const float d = points[p][i] - start[i];
+        along += d * dir[i];
+        dist_sq += sq(d);
+      }
+      // Points must advance along the line, without doubling back
+      if (along <= prev_along || along >= len) return false;
+      prev_along = along;
+      // Distance from the line
+      if (dist_sq - sq(along) > sq(COALESCE_TOLERANCE_MM)) return false;
+      // Extrusion proportional to distance
+      #if HAS_EXTRUDERS
+        if (ABS(points[p].e - (start.e + along * e_per_mm)) > e_tolerance) return false;
+      #endif
+    }
+    return true;
+  }
+
+  /**
+   * Extend the destination of the current G1 with the short G1 moves waiting in the
+   * command queue, for as long as the merged points stay on one line. Merged commands
+   * are acknowledged and removed from the queue.
+   */
+  static void coalesce_segments() {
+    // Only a G1 from the command queue
+    GCodeQueue::RingBuffer &ring = queue.ring_buffer;
+    const char * const cmd = ring.peek_next_command_string();
+    if (parser.codenum != 1 || !WITHIN(parser.command_ptr, cmd, cmd + MAX_CMD_SIZE - 1)) return;
+    if (TERN0(CANCEL_OBJECTS, cancelable.skipping) || TERN0(HAS_MEDIA, card.flag.logging)) return;
+
+    const xyze_pos_t &start = current_position;
+    auto seg_length_sq = [](const xyze_pos_t &a, const xyze_pos_t &b) {
+      float l = 0;
+      LOOP_NUM_AXES(i) l += sq(b[i] - a[i]);
+      return l;
+    };
+    if (seg_length_sq(start, destination) > sq(COALESCE_SEGMENT_MM)) return;
+
+    xyze_pos_t points[(COALESCE_MAX_SEGMENTS) - 1]; // The ends of the merged moves
+    uint8_t merged = 0;
+    bool parsed = false;
+
+    while (merged < (COALESCE_MAX_SEGMENTS) - 1 && ring.length > 1) {
+      GCodeQueue::CommandLine &next = ring.commands[ring.index_r + 1 < BUFSIZE ? ring.index_r + 1 : 0];
+      #if HAS_MULTI_SERIAL
+        if (next.port != ring.commands[ring.index_r].port) break;
+      #endif
+
+      parser.parse(next.buffer);
+      parsed = true;
+      if (parser.command_letter != 'G' || parser.codenum != 1 || TERN0(USE_GCODE_SUBCODES, parser.subcode)) break;
+
+      // Only axes, E, and an unchanged feedrate
+      bool plain = true;
+      for (const char *c = parser.command_ptr + 1; *c && plain; ++c) {
+        char l = *c;
+        if (TERN0(GCODE_CASE_INSENSITIVE, WITHIN(l, 'a', 'z'))) l += 'A' - 'a';
+        if (WITHIN(l, 'A', 'Z') && l != 'F' && !strchr(STR_AXES_LOGICAL, l)) plain = false;
+      }
+      if (!plain || (parser.floatval('F') > 0 && parser.value_feedrate() != feedrate_mm_s)) break;
+
+      // The end of the next move, relative to the end of this one
+      xyze_pos_t end = destination;
+      LOOP_NUM_AXES(i) if (parser.seenval(AXIS_CHAR(i))) {
+        const float v = parser.value_axis_units((AxisEnum)i);
+        end[i] = gcode.axis_is_relative(AxisEnum(i)) ? destination[i] + v : LOGICAL_TO_NATIVE(v, i);
+      }
+      #if HAS_EXTRUDERS
+        if (parser.seenval('E')) {
+          const float v = parser.value_axis_units(E_AXIS);
+          end.e = gcode.axis_is_relative(E_AXIS) ? destination.e + v : v;
+        }
+      #endif
+
+      const float len_sq = seg_length_sq(destination, end);
+      if (!len_sq || len_sq > sq(COALESCE_SEGMENT_MM)) break;
+
+      points[merged] = destination;
+      if (!points_on_line(start, end, points, merged + 1)) break;
+
+      // Take over the next move, replying "ok" to this one
+      #if ALL(PRINTCOUNTER, HAS_EXTRUDERS)
+        if (!DEBUGGING(DRYRUN)) print_job_timer.incFilamentUsed(end.e - destination.e);
+      #endif
+      destination = end;
+      merged++;
+      ring.ok_to_send();
+      ring.advance_r();
+      TERN_(POWER_LOSS_RECOVERY, recovery.queue_index_r = ring.index_r);
+    }
+
+    // Leave the parser with the command that's now current
+    if (parsed) parser.parse(ring.peek_next_command_string());
+  }
+
+#endif // SEGMENT_COALESCING
+
 /**
  * G0, G1: Coordinated movement of X Y Z E axes
  */
@@ -91,6 +223,10 @@ void GcodeSuite::G0_G1(TERN_(HAS_FAST_MOVES, const bool fast_move/*=false*/)) {
 
   #endif // FWRETRACT
 
+  #if ENABLED(SEGMENT_COALESCING)
+    if (TERN1(HAS_FAST_MOVES, !fast_move)) coalesce_segments();
+  #endif
+
   #if ANY(IS_SCARA, POLAR)
     fast_move ? prepare_fast_move_to_destination() : prepare_line_to_destination();
   #else
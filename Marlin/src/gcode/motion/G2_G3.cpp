@@ -27,7 +27,6 @@
 #include "../gcode.h"
 #include "../../module/motion.h"
 #include "../../module/planner.h"
-#include "../../module/temperature.h"
 
 #if N_ARC_CORRECTION < 1
   #undef N_ARC_CORRECTION
@@ -276,6 +275,9 @@ void plan_arc(
                 sin_T = theta_per_segment - sq_theta_per_segment * theta_per_segment / 6,
                 cos_T = 1 - 0.5f * sq_theta_per_segment; // Small angle approximation
 
+    // Exact radius of curvature of the path. For a helix it is larger than the arc radius.
+    const float curve_radius = TERN(HAS_Z_AXIS, radius + sq(travel_L / angular_travel) / radius, radius);
+
     ARC_LIJKUVWE_CODE(
       const float per_segment_L = travel_L / segments,
       const float per_segment_I = travel_I / segments,
@@ -299,7 +301,11 @@ void plan_arc(
       raw.e       = start_E
     );
 
-    millis_t next_idle_ms = millis() + 200UL;
+    #if !SECONDARY_AXES
+      // All the segments but the last have the same length, so tell the planner
+      const float chord_mm = 2.0f * radius * sin(0.5f * ABS(theta_per_segment));
+      hints.millimeters = TERN(HAS_Z_AXIS, HYPOT(chord_mm, per_segment_L), chord_mm);
+    #endif
 
     #if N_ARC_CORRECTION > 1
       int8_t arc_recalc_count = N_ARC_CORRECTION;
@@ -313,16 +319,13 @@ void plan_arc(
     // The last has to be calculated every time through the loop.
     const float limiting_accel = _MIN(planner.settings.max_acceleration_mm_per_s2[axis_p], planner.settings.max_acceleration_mm_per_s2[axis_q]),
                 limiting_speed = _MIN(planner.settings.max_feedrate_mm_s[axis_p], planner.settings.max_feedrate_mm_s[axis_q]),
-                limiting_speed_sqr = _MIN(sq(limiting_speed), limiting_accel * radius, sq(scaled_fr_mm_s));
+                limiting_speed_sqr = _MIN(sq(limiting_speed), limiting_accel * curve_radius, sq(scaled_fr_mm_s));
 
     for (uint16_t i = 1; i < segments; i++) { // Iterate (segments-1) times
 
-      thermalManager.task();
-      const millis_t ms = millis();
-      if (ELAPSED(ms, next_idle_ms)) {
-        next_idle_ms = ms + 200UL;
-        idle();
-      }
+      // Work out each segment only once the planner has room for it,
+      // so idle() keeps running while the arc waits for the planner.
+      while (planner.is_full()) idle();
 
       #if N_ARC_CORRECTION > 1
         if (--arc_recalc_count) {
@@ -374,7 +377,7 @@ void plan_arc(
       if (!planner.buffer_line(raw, scaled_fr_mm_s, active_extruder, hints))
         break;
 
-      hints.curve_radius = radius;
+      hints.curve_radius = curve_radius;
     }
   }
 
@@ -387,7 +390,8 @@ void plan_arc(
     planner.apply_leveling(raw);
   #endif
 
-  hints.curve_radius = 0;
+  // The last junction is still on the curve, but the move that follows is unknown
+  hints.millimeters = 0.0f;
   hints.safe_exit_speed_sqr = 0.0f;
   planner.buffer_line(raw, scaled_fr_mm_s, active_extruder, hints);
 
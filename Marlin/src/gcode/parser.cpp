@@ -62,6 +62,13 @@ uint16_t GCodeParser::codenum;
   // Optimized Parameters
   uint32_t GCodeParser::codebits; // found bits
   uint8_t GCodeParser::param[26]; // parameter offsets from command_ptr
+  #if ENABLED(FASTER_GCODE_VALUES)
+    GCodeParser::param_value_t GCodeParser::param_value[GCODE_VALUE_SLOTS];
+    uint8_t GCodeParser::value_slot[26],
+            GCodeParser::value_count,
+            GCodeParser::seen_slot;
+    uint16_t GCodeParser::value_is_float;
+  #endif
 #else
   char *GCodeParser::command_args; // start of parameters
 #endif
@@ -83,9 +90,74 @@ void GCodeParser::reset() {
   #if ENABLED(FASTER_GCODE_PARSER)
     codebits = 0;       // No codes yet
     //ZERO(param);      // No parameters (should be safe to comment out this line)
+    #if ENABLED(FASTER_GCODE_VALUES)
+      value_count = 0;    // No values stored
+      value_is_float = 0;
+    #endif
   #endif
 }
 
+#if ENABLED(FASTER_GCODE_VALUES)
+
+  /**
+   * Convert a parameter value into the next free slot, returning the slot + 1.
+   * Returns 0 to have the value read from the text, as for:
+   *  - More parameters than GCODE_VALUE_SLOTS
+   *  - Integers with more than 9 digits
+   *  - Decimals that don't fit in 24 bits, or with more than 10 fraction digits
+   *
+   * Integers are stored as a long. Decimals are stored as the float nearest to
+   * their value, which is the same float returned by strtof. Parsing stops at
+   * the first character that isn't part of the number, just like value_float
+   * and value_long, so "1E5" is stored as 1.
+   */
+  uint8_t GCodeParser::store_value(const char * const p) {
+    if (value_count >= GCODE_VALUE_SLOTS || !valid_number(p)) return 0;
+
+    const char *c = p;
+    const bool neg = *c == '-';
+    if (neg || *c == '+') ++c;
+
+    uint32_t m = 0;               // Significant digits
+    uint8_t digits = 0;           // Number of significant digits (up to 9)
+    for (; NUMERIC(*c); ++c) {
+      if (!m && *c == '0') continue;
+      if (++digits > 9) return 0;
+      m = m * 10 + *c - '0';
+    }
+
+    param_value_t &v = param_value[value_count];
+    if (*c != '.' && (m || !neg)) { // Integer, except -0 which is a float
+      v.l = neg ? -int32_t(m) : int32_t(m);
+    }
+    else {
+      uint8_t frac = 0, zeros = 0; // Fraction digits, pending zeros
+      if (*c == '.')
+        for (++c; NUMERIC(*c); ++c) {
+          if (*c == '0') { ++zeros; continue; } // Trailing zeros don't change the value
+          frac += zeros + 1;
+          if (m) {
+            digits += zeros;
+            if (digits >= 9) return 0;
+            for (; zeros; --zeros) m *= 10;
+          }
+          ++digits;
+          zeros = 0;
+          m = m * 10 + *c - '0';
+        }
+      // Both numbers are exact floats, so the quotient is correctly rounded
+      static constexpr float pow_10[] = { 1e0f, 1e1f, 1e2f, 1e3f, 1e4f, 1e5f, 1e6f, 1e7f, 1e8f, 1e9f, 1e10f };
+      if (m > _BV32(24) || frac >= COUNT(pow_10)) return 0;
+      const float f = float(m) / pow_10[frac];
+      v.f = neg ? -f : f;
+      SBI(value_is_float, value_count);
+    }
+
+    return ++value_count;
+  }
+
+#endif
+
 #if ENABLED(GCODE_QUOTED_STRINGS)
 
   // Pass the address after the first quote (if any)
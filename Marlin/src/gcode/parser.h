@@ -49,6 +49,8 @@
  *  - FASTER_GCODE_PARSER:
  *    - Flags existing params (1 bit each)
  *    - Stores value offsets (1 byte each)
+ *  - FASTER_GCODE_VALUES:
+ *    - Converts numeric values while parsing (4 bytes each)
  *  - Provide accessors for parameters:
  *    - Parameter exists
  *    - Parameter has value
@@ -62,6 +64,15 @@ private:
   #if ENABLED(FASTER_GCODE_PARSER)
     static uint32_t codebits;  // Parameters pre-scanned
     static uint8_t param[26];  // For A-Z, offsets into command args
+    #if ENABLED(FASTER_GCODE_VALUES)
+      typedef union { float f; int32_t l; } param_value_t;
+      static param_value_t param_value[GCODE_VALUE_SLOTS]; // Values converted by parse
+      static uint8_t value_slot[26],  // For A-Z, value slot + 1 (0 = read from text)
+                     value_count,     // Value slots used
+                     seen_slot;       // Set by seen, value slot + 1 for value_ptr
+      static uint16_t value_is_float; // Slots holding a float (otherwise a long)
+      static uint8_t store_value(const char * const p);
+    #endif
   #else
     static char *command_args; // Args start here, for slow scan
   #endif
@@ -131,6 +142,7 @@ public:
       if (ind >= COUNT(param)) return;          // Only A-Z
       SBI32(codebits, ind);                     // parameter exists
       param[ind] = ptr ? ptr - command_ptr : 0; // parameter offset or 0
+      TERN_(FASTER_GCODE_VALUES, value_slot[ind] = ptr ? store_value(ptr) : 0); // converted value or 0
       #if ENABLED(DEBUG_GCODE_PARSER)
         if (codenum == 800) {
           SERIAL_ECHOPGM("Set bit ", ind, " of codebits (", hex_address((void*)(codebits >> 16)));
@@ -147,9 +159,10 @@ public:
       if (ind >= COUNT(param)) return false; // Only A-Z
       const bool b = TEST32(codebits, ind);
       if (b) {
+        TERN_(FASTER_GCODE_VALUES, seen_slot = value_slot[ind]);
         if (param[ind]) {
           char * const ptr = command_ptr + param[ind];
-          value_ptr = valid_number(ptr) ? ptr : nullptr;
+          value_ptr = TERN0(FASTER_GCODE_VALUES, seen_slot) || valid_number(ptr) ? ptr : nullptr;
         }
         else
           value_ptr = nullptr;
@@ -257,6 +270,12 @@ public:
   // Float removes 'E' to prevent scientific notation interpretation
   static float value_float() {
     if (!value_ptr) return 0;
+    #if ENABLED(FASTER_GCODE_VALUES)
+      if (seen_slot) {
+        const param_value_t &v = param_value[seen_slot - 1];
+        return TEST(value_is_float, seen_slot - 1) ? v.f : float(v.l);
+      }
+    #endif
     char *e = value_ptr;
     for (;;) {
       const char c = *e;
@@ -273,8 +292,19 @@ public:
   }
 
   // Code value as a long or ulong
-  static int32_t value_long() { return value_ptr ? strtol(value_ptr, nullptr, 10) : 0L; }
-  static uint32_t value_ulong() { return value_ptr ? strtoul(value_ptr, nullptr, 10) : 0UL; }
+  #if ENABLED(FASTER_GCODE_VALUES)
+    // A long converted by parse (not a float, which strtol would truncate differently)
+    FORCE_INLINE static bool has_long_value() { return seen_slot && !TEST(value_is_float, seen_slot - 1); }
+    static int32_t value_long() {
+      return has_long_value() ? param_value[seen_slot - 1].l : value_ptr ? strtol(value_ptr, nullptr, 10) : 0L;
+    }
+    static uint32_t value_ulong() {
+      return has_long_value() ? uint32_t(param_value[seen_slot - 1].l) : value_ptr ? strtoul(value_ptr, nullptr, 10) : 0UL;
+    }
+  #else
+    static int32_t value_long() { return value_ptr ? strtol(value_ptr, nullptr, 10) : 0L; }
+    static uint32_t value_ulong() { return value_ptr ? strtoul(value_ptr, nullptr, 10) : 0UL; }
+  #endif
 
   // Code value for use as time
   static millis_t value_millis() { return value_ulong(); }
@@ -28,6 +28,7 @@
 GCodeQueue queue;
 
 #include "gcode.h"
+#include "queue_stream.h"
 
 #include "../lcd/marlinui.h"
 #include "../sd/cardreader.h"
@@ -41,6 +42,10 @@ GCodeQueue queue;
   #include "../feature/binary_stream.h"
 #endif
 
+#if ENABLED(COMPACT_MOVE_PROTOCOL)
+  #include "../feature/compact_moves.h"
+#endif
+
 #if ENABLED(POWER_LOSS_RECOVERY)
   #include "../feature/powerloss.h"
 #endif
@@ -331,64 +336,6 @@ FORCE_INLINE bool is_M29(const char * const cmd) {  // matches "M29" & "M29 ", b
   return m29 && !NUMERIC(m29[3]);
 }
 
-#define PS_NORMAL 0
-#define PS_EOL    1
-#define PS_QUOTED 2
-#define PS_PAREN  3
-#define PS_ESC    4
-
-inline void process_stream_char(const char c, uint8_t &sis, char (&buff)[MAX_CMD_SIZE], int &ind) {
-
-  if (sis == PS_EOL) return; // EOL comment or overflow
-
-  #if ENABLED(PAREN_COMMENTS)
-    else if (sis == PS_PAREN) { // Inline comment
-      if (c == ')') sis = PS_NORMAL;
-      return;
-    }
-  #endif
-
-  else if (sis >= PS_ESC)      // End escaped char
-    sis -= PS_ESC;
-
-  else if (c == '\\') {        // Start escaped char
-    sis += PS_ESC;
-    if (sis == PS_ESC) return; // Keep if quoting
-  }
-
-  #if ENABLED(GCODE_QUOTED_STRINGS)
-
-    else if (sis == PS_QUOTED) {
-      if (c == '"') sis = PS_NORMAL; // End quoted string
-    }
-    else if (c == '"') // Start quoted string
-      sis = PS_QUOTED;
-
-  #endif
-
-  else if (c == ';') { // Start end-of-line comment
-    sis = PS_EOL;
-    return;
-  }
-
-  #if ENABLED(PAREN_COMMENTS)
-    else if (c == '(') { // Start inline comment
-      sis = PS_PAREN;
-      return;
-    }
-  #endif
-
-  // Backspace erases previous characters
-  if (c == 0x08) {
-    if (ind) buff[--ind] = '\0';
-  }
-  else {
-    buff[ind++] = c;
-    if (ind >= MAX_CMD_SIZE - 1)
-      sis = PS_EOL; // Skip the rest on overflow
-  }
-}
-
 /**
  * Handle a line being completed. For an empty line
  * keep sensor readings going and watchdog alive.
@@ -441,6 +388,14 @@ void GCodeQueue::get_serial_commands() {
       // Check if the queue is full and exit if it is.
       if (ring_buffer.full()) return;
 
+      #if ENABLED(COMPACT_MOVE_PROTOCOL)
+        // This port sends compact move frames instead of lines
+        if (compactMoves.owns_port(p)) {
+          if (compactMoves.receive()) hadData = true;
+          continue;
+        }
+      #endif
+
       // No data for this port ? Skip it
       if (!serial_data_available(p)) continue;
 
@@ -571,17 +526,39 @@ void GCodeQueue::get_serial_commands() {
 
     int sd_count = 0;
     while (!ring_buffer.full() && !card.eof()) {
-      const int16_t n = card.get();
-      const bool card_eof = card.eof();
-      if (n < 0 && !card_eof) { SERIAL_ERROR_MSG(STR_SD_ERR_READ); continue; }
-
       CommandLine &command = ring_buffer.commands[ring_buffer.index_w];
-      const char sd_char = (char)n;
-      const bool is_eol = ISEOL(sd_char);
+
+      #if ENABLED(SD_READ_AHEAD)
+
+        // Split lines straight out of the read-ahead buffer
+        const uint8_t *chunk;
+        const int16_t len = card.stream_peek(chunk);
+        if (len <= 0) { SERIAL_ERROR_MSG(STR_SD_ERR_READ); continue; }
+
+        const uint16_t i = process_stream_block(chunk, len, sd_input_state, command.buffer, sd_count);
+        const bool is_eol = i < uint16_t(len);
+        card.stream_consume(i + is_eol);
+        const bool card_eof = card.eof();
+
+      #else
+
+        const int16_t n = card.get();
+        const bool card_eof = card.eof();
+        if (n < 0 && !card_eof) { SERIAL_ERROR_MSG(STR_SD_ERR_READ); continue; }
+
+        const char sd_char = (char)n;
+        const bool is_eol = ISEOL(sd_char);
+        if (!is_eol && !card_eof) {
+          process_stream_char(sd_char, sd_input_state, command.buffer, sd_count);
+          continue;
+        }
+        if (!is_eol && sd_count) ++sd_count; // End of file with no newline
+
+      #endif
+
       if (is_eol || card_eof) {
 
         // Reset stream state, terminate the buffer, and commit a non-empty command
-        if (!is_eol && sd_count) ++sd_count; // End of file with no newline
         if (!process_line_done(sd_input_state, command.buffer, sd_count)) {
 
           // M808 L saves the sdpos of the next line. M808 loops to a new sdpos.
@@ -603,8 +580,6 @@ void GCodeQueue::get_serial_commands() {
 
         if (card.eof()) card.fileHasFinished(); // Handle end of file reached
       }
-      else
-        process_stream_char(sd_char, sd_input_state, command.buffer, sd_count);
     }
   }
 
@@ -617,7 +592,11 @@ void GCodeQueue::get_serial_commands() {
  *  - The SD card file being actively printed
  */
 void GCodeQueue::get_available_commands() {
-  if (ring_buffer.full()) return;
+  if (ring_buffer.full()) {
+    // Read ahead while there's nothing to queue
+    TERN_(SD_READ_AHEAD, if (IS_SD_FETCHING()) card.read_ahead());
+    return;
+  }
 
   get_serial_commands();
 
@@ -642,6 +621,7 @@ void GCodeQueue::advance() {
 
   // Return if the G-code buffer is empty
   if (ring_buffer.empty()) {
+    TERN_(COMPACT_MOVE_PROTOCOL, compactMoves.advance()); // Compact moves run in order after queued commands
     #if ENABLED(BUFFER_MONITORING)
       if (!command_buffer_empty) {
         command_buffer_empty = true;
@@ -0,0 +1,167 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2020 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+#pragma once
+
+/**
+ * queue_stream.h - Split a character stream into G-code command lines,
+ *                  dropping comments and handling escapes and quotes.
+ */
+
+#include "../inc/MarlinConfigPre.h"
+
+#define PS_NORMAL 0
+#define PS_EOL    1
+#define PS_QUOTED 2
+#define PS_PAREN  3
+#define PS_ESC    4
+
+inline void process_stream_char(const char c, uint8_t &sis, char (&buff)[MAX_CMD_SIZE], int &ind) {
+
+  if (sis == PS_EOL) return; // EOL comment or overflow
+
+  #if ENABLED(PAREN_COMMENTS)
+    else if (sis == PS_PAREN) { // Inline comment
+      if (c == ')') sis = PS_NORMAL;
+      return;
+    }
+  #endif
+
+  else if (sis >= PS_ESC)      // End escaped char
+    sis -= PS_ESC;
+
+  else if (c == '\\') {        // Start escaped char
+    sis += PS_ESC;
+    if (sis == PS_ESC) return; // Keep if quoting
+  }
+
+  #if ENABLED(GCODE_QUOTED_STRINGS)
+
+    else if (sis == PS_QUOTED) {
+      if (c == '"') sis = PS_NORMAL; // End quoted string
+    }
+    else if (c == '"') // Start quoted string
+      sis = PS_QUOTED;
+
+  #endif
+
+  else if (c == ';') { // Start end-of-line comment
+    sis = PS_EOL;
+    return;
+  }
+
+  #if ENABLED(PAREN_COMMENTS)
+    else if (c == '(') { // Start inline comment
+      sis = PS_PAREN;
+      return;
+    }
+  #endif
+
+  // Backspace erases previous characters
+  if (c == 0x08) {
+    if (ind) buff[--ind] = '\0';
+  }
+  else {
+    buff[ind++] = c;
+    if (ind >= MAX_CMD_SIZE - 1)
+      sis = PS_EOL; // Skip the rest on overflow
+  }
+}
+
+/**
+ * Word-at-a-time (SWAR) scanning. Each test flags every byte of a word that
+ * equals a given character, so a whole word of ordinary characters is passed
+ * over with a few ALU operations. 8-bit CPUs just scan bytes.
+ */
+#ifndef __AVR__
+  typedef uintptr_t stream_word_t;
+  #define SWAR_ONES  (~stream_word_t(0) / 0xFF)
+  #define SWAR_HIGHS (SWAR_ONES << 7)
+  #define _SWAR_ZERO(X) (((X) - SWAR_ONES) & ~(X) & SWAR_HIGHS)
+  #define SWAR_HAS(W,C) _SWAR_ZERO((W) ^ (SWAR_ONES * uint8_t(C)))
+#endif
+
+// Characters that act on the stream state in PS_NORMAL
+FORCE_INLINE bool stream_char_is_plain(const char c) {
+  return !(ISEOL(c) || c == ';' || c == '\\' || c == 0x08
+    || TERN0(PAREN_COMMENTS, c == '(') || TERN0(GCODE_QUOTED_STRINGS, c == '"')
+  );
+}
+
+// Length of the leading run of characters with no special meaning
+inline uint16_t stream_plain_run(const uint8_t * const buf, const uint16_t len) {
+  uint16_t i = 0;
+  #ifndef __AVR__
+    for (; i + sizeof(stream_word_t) <= len; i += sizeof(stream_word_t)) {
+      stream_word_t w;
+      memcpy(&w, buf + i, sizeof(w));
+      if (SWAR_HAS(w, '\n') | SWAR_HAS(w, '\r') | SWAR_HAS(w, ';') | SWAR_HAS(w, '\\') | SWAR_HAS(w, 0x08)
+          TERN_(PAREN_COMMENTS, | SWAR_HAS(w, '(')) TERN_(GCODE_QUOTED_STRINGS, | SWAR_HAS(w, '"'))
+      ) break;
+    }
+  #endif
+  while (i < len && stream_char_is_plain(buf[i])) ++i;
+  return i;
+}
+
+// Length of the leading run before an end-of-line
+inline uint16_t stream_line_run(const uint8_t * const buf, const uint16_t len) {
+  uint16_t i = 0;
+  #ifndef __AVR__
+    for (; i + sizeof(stream_word_t) <= len; i += sizeof(stream_word_t)) {
+      stream_word_t w;
+      memcpy(&w, buf + i, sizeof(w));
+      if (SWAR_HAS(w, '\n') | SWAR_HAS(w, '\r')) break;
+    }
+  #endif
+  while (i < len && !ISEOL(buf[i])) ++i;
+  return i;
+}
+
+/**
+ * Process buffered stream data into a command line, stopping at an end-of-line.
+ * Runs of ordinary characters are copied with one memcpy and comments are skipped
+ * whole, so process_stream_char only sees the characters that change the state.
+ * Return the number of bytes used, which is the index of the EOL if one was found.
+ */
+inline uint16_t process_stream_block(const uint8_t * const buf, const uint16_t len, uint8_t &sis, char (&buff)[MAX_CMD_SIZE], int &ind) {
+  uint16_t i = 0;
+  while (i < len) {
+    if (sis == PS_NORMAL) {
+      const uint16_t run = stream_plain_run(buf + i, len - i);
+      if (run) {
+        const uint16_t n = _MIN(run, uint16_t(MAX_CMD_SIZE - 1 - ind));
+        memcpy(&buff[ind], buf + i, n);
+        ind += n;
+        if (ind >= MAX_CMD_SIZE - 1) sis = PS_EOL; // Skip the rest on overflow
+        i += run;
+        continue;
+      }
+    }
+    else if (sis == PS_EOL) {
+      i += stream_line_run(buf + i, len - i);   // Skip to the end of the line
+      break;
+    }
+    if (ISEOL(buf[i])) break;
+    process_stream_char(buf[i++], sis, buff, ind);
+  }
+  return i;
+}
@@ -1406,6 +1406,9 @@
     #define FTM_WINDOW_SIZE FTM_BW_SIZE
     #define FTM_BATCH_SIZE  FTM_BW_SIZE
   #endif
+  #ifndef FTM_DYNFREQ_TOLERANCE
+    #define FTM_DYNFREQ_TOLERANCE 0.1f
+  #endif
 #endif
 
 // Multi-Stepping Limit
@@ -2651,6 +2651,9 @@
 #if ANY(HAS_PID_HEATING, MPC_AUTOTUNE) && ENABLED(DWIN_LCD_PROUI) && DISABLED(DISABLE_TUNING_GRAPH)
   #define PROUI_TUNING_GRAPH 1
 #endif
+#if !(ENABLED(DWIN_LCD_PROUI) && ANY(PROUI_TUNING_GRAPH, PROUI_ITEM_PLOT))
+  #undef PROUI_TEMP_HISTORY
+#endif
 
 // Thermal protection
 #if ENABLED(THERMAL_PROTECTION_HOTENDS) && WATCH_TEMP_PERIOD > 0
@@ -2763,7 +2766,7 @@
 #if !HAS_TEMP_SENSOR
   #undef AUTO_REPORT_TEMPERATURES
 #endif
-#if ANY(AUTO_REPORT_TEMPERATURES, AUTO_REPORT_SD_STATUS, AUTO_REPORT_POSITION, AUTO_REPORT_FANS)
+#if ANY(AUTO_REPORT_TEMPERATURES, AUTO_REPORT_SD_STATUS, AUTO_REPORT_POSITION, AUTO_REPORT_FANS, PLANNER_HEALTH)
   #define HAS_AUTO_REPORTING 1
 #endif
 
@@ -151,6 +151,50 @@ static_assert(COUNT(arm) == LOGICAL_AXES, "AXIS_RELATIVE_MODES must contain " _L
   #endif
 #endif
 
+/**
+ * SD Read-Ahead requirements
+ */
+#if ENABLED(SD_READ_AHEAD)
+  #if !HAS_MEDIA
+    #error "SD_READ_AHEAD requires SDSUPPORT."
+  #elif !WITHIN(SD_READ_AHEAD_BLOCKS, 2, 16)
+    #error "SD_READ_AHEAD_BLOCKS must be between 2 and 16."
+  #endif
+#endif
+
+/**
+ * Compact Move Protocol requirements
+ */
+#if ENABLED(COMPACT_MOVE_PROTOCOL) && MAX_CMD_SIZE > 250
+  #error "COMPACT_MOVE_PROTOCOL requires MAX_CMD_SIZE of 250 or less."
+#endif
+
+/**
+ * Pre-parsed G-code values requirements
+ */
+#if ENABLED(FASTER_GCODE_VALUES)
+  #if DISABLED(FASTER_GCODE_PARSER)
+    #error "FASTER_GCODE_VALUES requires FASTER_GCODE_PARSER."
+  #elif !WITHIN(GCODE_VALUE_SLOTS, 1, 16)
+    #error "GCODE_VALUE_SLOTS must be between 1 and 16."
+  #endif
+#endif
+
+/**
+ * Direct Thermistor Lookup requirements
+ */
+#if ENABLED(THERMISTOR_DIRECT_LOOKUP)
+  #if !WITHIN(THERMISTOR_DIRECT_BITS, 6, 12)
+    #error "THERMISTOR_DIRECT_BITS must be between 6 and 12."
+  #elif THERMISTOR_DIRECT_CHECK_MIN >= THERMISTOR_DIRECT_CHECK_MAX
+    #error "THERMISTOR_DIRECT_CHECK_MIN must be less than THERMISTOR_DIRECT_CHECK_MAX."
+  #elif ENABLED(THERMISTOR_DIRECT_USER) && !HAS_USER_THERMISTORS
+    #error "THERMISTOR_DIRECT_USER requires a User Thermistor (TEMP_SENSOR_* 1000)."
+  #endif
+#elif ENABLED(THERMISTOR_DIRECT_USER)
+  #error "THERMISTOR_DIRECT_USER requires THERMISTOR_DIRECT_LOOKUP."
+#endif
+
 /**
  * Probe temp compensation requirements
  */
@@ -2631,6 +2675,24 @@ static_assert(NUM_SERVOS <= NUM_SERVO_PLUGS, "NUM_SERVOS (or some servo index) i
   #endif
 #endif
 
+/**
+ * ISR Timing
+ */
+#if ENABLED(ISR_TIMING) && DISABLED(MARLIN_DEV_MODE)
+  #error "ISR_TIMING requires MARLIN_DEV_MODE."
+#endif
+
+/**
+ * G1 Segment Coalescing
+ */
+#if ENABLED(SEGMENT_COALESCING)
+  #if !WITHIN(COALESCE_MAX_SEGMENTS, 2, 255)
+    #error "COALESCE_MAX_SEGMENTS must be from 2 to 255."
+  #endif
+  static_assert(COALESCE_TOLERANCE_MM > 0, "COALESCE_TOLERANCE_MM must be greater than 0.");
+  static_assert(COALESCE_SEGMENT_MM > 0, "COALESCE_SEGMENT_MM must be greater than 0.");
+#endif
+
 /**
  * RGB_LED Requirements
  */
@@ -2931,6 +2993,14 @@ static_assert(NUM_SERVOS <= NUM_SERVO_PLUGS, "NUM_SERVOS (or some servo index) i
   #endif
 #endif
 
+#if defined(PROUI_TEMP_HISTORY) && !WITHIN(PROUI_TEMP_HISTORY, 240, 4096)
+  #error "PROUI_TEMP_HISTORY must be from 240 to 4096."
+#endif
+
+#if ENABLED(DWIN_TX_QUEUE) && !(WITHIN(DWIN_TX_QUEUE_SIZE, 64, 32768) && IS_POWER_OF_2(DWIN_TX_QUEUE_SIZE))
+  #error "DWIN_TX_QUEUE_SIZE must be a power of 2 from 64 to 32768."
+#endif
+
 #if HAS_BACKLIGHT_TIMEOUT
   #if !HAS_ENCODER_ACTION && DISABLED(HAS_DWIN_E3V2)
     #error "LCD_BACKLIGHT_TIMEOUT_MINS requires an LCD with encoder or keypad."
@@ -4454,6 +4524,16 @@ static_assert(WITHIN(MULTISTEPPING_LIMIT, 1, 128) && IS_POWER_OF_2(MULTISTEPPING
   #error "Only enable ULTIPANEL_FEEDMULTIPLY or ULTIPANEL_FLOWPERCENT, but not both."
 #endif
 
+// Planner / Stepper replay benchmark
+#if ENABLED(REPLAY_BENCH) && !defined(__PLAT_NATIVE_SIM__)
+  #error "REPLAY_BENCH is only for the native simulator build. Use env:simulator_linux_bench."
+#endif
+
+// Command queue ingest benchmark
+#if ENABLED(INGEST_BENCH) && !defined(__PLAT_NATIVE_SIM__)
+  #error "INGEST_BENCH is only for the native simulator build. Use env:simulator_linux_ingest_bench."
+#endif
+
 // Misc. Cleanup
 #undef _TEST_PWM
 #undef _NUM_AXES_STR
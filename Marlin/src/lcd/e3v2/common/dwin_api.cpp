@@ -38,11 +38,72 @@ uint8_t DWIN_BufTail[4] = { 0xCC, 0x33, 0xC3, 0x3C };
 uint8_t databuf[26] = { 0 };
 bool need_lcd_update = true;
 
+#if ENABLED(DWIN_TX_QUEUE)
+
+  DWINTxQueue<DWIN_TX_QUEUE_SIZE> dwinTxQueue;
+
+  // Hand queued bytes to the UART without waiting for room
+  void DWIN_TxService() {
+    const uint8_t *data;
+    while (uint16_t len = dwinTxQueue.contiguous(data)) {
+      #ifdef LCD_SERIAL_TX_BUFFER_FREE
+        const size_t room = LCD_SERIAL_TX_BUFFER_FREE();
+        if (room == 0) break;
+        NOMORE(len, room);
+      #endif
+      LCD_SERIAL.write(data, len);
+      dwinTxQueue.consume(len);
+    }
+  }
+
+  // Wait until all queued bytes have been handed to the UART
+  void DWIN_TxFlush() {
+    while (!dwinTxQueue.isEmpty()) DWIN_TxService();
+  }
+
+  // Queue a block of bytes, draining the queue to make room when it's full
+  void DWIN_SendBytes(const uint8_t * const data, size_t len) {
+    TERN_(DWIN_TX_STATS, dwinTxStats.bytes += len);
+    size_t n = 0;
+    while (n < len) {
+      const uint16_t chunk = _MIN(len - n, dwinTxQueue.room());
+      if (chunk) { dwinTxQueue.push(data + n, chunk); n += chunk; }
+      else DWIN_TxService();
+    }
+  }
+
+#else
+
+  // Send a block of bytes directly to the UART
+  void DWIN_SendBytes(const uint8_t * const data, size_t len) {
+    TERN_(DWIN_TX_STATS, dwinTxStats.bytes += len);
+    for (size_t n = 0; n < len; ++n) { LCD_SERIAL.write(data[n]); delayMicroseconds(1); }
+  }
+
+#endif
+
+#if ENABLED(DWIN_TX_STATS)
+
+  dwin_tx_stats_t dwinTxStats{0};
+
+  // Latch the per-second rates once a second has elapsed
+  void dwin_tx_stats_t::update(const millis_t ms) {
+    if (PENDING(ms, next_ms)) return;
+    packets_ps = packets - packets_mark;
+    bytes_ps = bytes - bytes_mark;
+    packets_mark = packets;
+    bytes_mark = bytes;
+    next_ms = ms + 1000UL;
+  }
+
+#endif
+
 // Send the data in the buffer plus the packet tail
 void DWIN_Send(size_t &i) {
   ++i;
-  for (uint8_t n = 0; n < i; ++n) { LCD_SERIAL.write(DWIN_SendBuf[n]); delayMicroseconds(1); }
-  for (uint8_t n = 0; n < 4; ++n) { LCD_SERIAL.write(DWIN_BufTail[n]); delayMicroseconds(1); }
+  DWIN_SendBytes(DWIN_SendBuf, i);
+  DWIN_SendBytes(DWIN_BufTail, 4);
+  TERN_(DWIN_TX_STATS, dwinTxStats.packets++);
   need_lcd_update = true;
 }
 
@@ -61,6 +122,7 @@ bool DWIN_Handshake() {
   size_t i = 0;
   DWIN_Byte(i, 0x00);
   DWIN_Send(i);
+  DWIN_TxFlush();
   delay(10);
 
   while (LCD_SERIAL.available() > 0 && recnum < (signed)sizeof(databuf)) {
@@ -114,6 +176,8 @@ void DWIN_UpdateLCD() {
     DWIN_Send(i);
     need_lcd_update = false;
   }
+  DWIN_TxService();
+  TERN_(DWIN_TX_STATS, dwinTxStats.update(millis()));
 }
 
 /*---------------------------------------- Drawing functions ----------------------------------------*/
@@ -70,6 +70,35 @@ inline void DWIN_Long(size_t &i, const uint32_t lval) {
 // Send the data in the buffer plus the packet tail
 void DWIN_Send(size_t &i);
 
+// Send a raw block of bytes (packet header, payload or tail)
+void DWIN_SendBytes(const uint8_t * const data, size_t len);
+
+#if ENABLED(DWIN_TX_QUEUE)
+  #include "dwin_queue.h"
+  extern DWINTxQueue<DWIN_TX_QUEUE_SIZE> dwinTxQueue;
+
+  // Hand queued bytes to the UART without waiting for room
+  void DWIN_TxService();
+
+  // Wait until all queued bytes have been handed to the UART
+  void DWIN_TxFlush();
+#else
+  inline void DWIN_TxService() {}
+  inline void DWIN_TxFlush() {}
+#endif
+
+#if ENABLED(DWIN_TX_STATS)
+  // LCD traffic counters, to measure what a screen update costs on the wire
+  typedef struct {
+    uint32_t packets, bytes;              // Totals since boot
+    uint32_t packets_ps, bytes_ps;        // Rates over the last full second
+    uint32_t packets_mark, bytes_mark;    // Totals at the start of the current second
+    millis_t next_ms;
+    void update(const millis_t ms);
+  } dwin_tx_stats_t;
+  extern dwin_tx_stats_t dwinTxStats;
+#endif
+
 inline void DWIN_Text(size_t &i, PGM_P const string, uint16_t rlimit=0xFFFF) {
   if (!string) return;
   const size_t len = _MIN(sizeof(DWIN_SendBuf) - i, _MIN(strlen(string), rlimit));
@@ -105,6 +134,7 @@ void DWIN_Startup();
 void DWIN_Frame_SetDir(uint8_t dir);
 
 // Update display
+//  With DWIN_TX_QUEUE this is also the point where queued packets are handed to the UART
 void DWIN_UpdateLCD();
 
 /*---------------------------------------- Drawing functions ----------------------------------------*/
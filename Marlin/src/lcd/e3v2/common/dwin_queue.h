@@ -0,0 +1,96 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2024 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+#pragma once
+
+//
+// e3v2/common/dwin_queue.h
+//
+// Byte FIFO used to batch framed DWIN packets (DWIN_TX_QUEUE).
+// Draw calls append whole packets and the transport drains them in
+// contiguous runs, so the UART can be fed without a per-byte busy wait.
+//
+// Included by: e3v2/common/dwin_api.h
+//
+
+#include <stdint.h>
+#include <stddef.h>
+#include <string.h>
+
+template<uint16_t SIZE>
+class DWINTxQueue {
+  static_assert(SIZE >= 64 && !(SIZE & (SIZE - 1)), "DWINTxQueue SIZE must be a power of 2 (64 or more).");
+
+  private:
+    uint8_t buffer[SIZE];
+    volatile uint16_t head, tail; // Bytes are written at head and read from tail
+
+    static constexpr uint16_t mask(const uint16_t i) { return i & (SIZE - 1); }
+
+  public:
+    DWINTxQueue() { clear(); }
+
+    void clear() { head = tail = 0; }
+
+    // Bytes waiting to be sent
+    uint16_t used() const { return uint16_t(head - tail); }
+
+    // Bytes that can still be queued
+    uint16_t room() const { return SIZE - used(); }
+
+    bool isEmpty() const { return head == tail; }
+
+    // Append len bytes. All or nothing, so a packet is never split by a full queue.
+    bool push(const uint8_t * const data, const uint16_t len) {
+      if (len > room()) return false;
+      const uint16_t h = mask(head), first = len < SIZE - h ? len : SIZE - h;
+      memcpy(&buffer[h], data, first);
+      memcpy(buffer, data + first, len - first);
+      head = head + len;
+      return true;
+    }
+
+    // Get the longest run of queued bytes that doesn't wrap around the end of the buffer.
+    // Suitable for handing straight to a UART write or a DMA transfer.
+    uint16_t contiguous(const uint8_t *&data) const {
+      const uint16_t n = used(), t = mask(tail), run = SIZE - t;
+      data = &buffer[t];
+      return n < run ? n : run;
+    }
+
+    // Release bytes that have been handed to the UART
+    void consume(const uint16_t len) { tail = tail + (len < used() ? len : used()); }
+
+    // Copy out up to len bytes, returning the number copied
+    uint16_t pop(uint8_t * const data, const uint16_t len) {
+      uint16_t count = 0;
+      while (count < len) {
+        const uint8_t *src;
+        uint16_t run = contiguous(src);
+        if (!run) break;
+        if (run > len - count) run = len - count;
+        memcpy(data + count, src, run);
+        consume(run);
+        count += run;
+      }
+      return count;
+    }
+};
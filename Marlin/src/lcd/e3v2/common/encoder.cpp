@@ -124,6 +124,7 @@ EncoderState encoderReceiveAnalyze() {
 
     #endif
 
+    encoderRate.encoderMoveSteps = abs_diff / (ENCODER_PULSES_PER_STEP);
     encoderRate.encoderMoveValue = abs_diff * encoder_multiplier / (ENCODER_PULSES_PER_STEP);
 
     temp_diff = 0;
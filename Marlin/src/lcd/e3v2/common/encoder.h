@@ -33,6 +33,7 @@
 typedef struct {
   bool enabled = false;
   int encoderMoveValue = 0;
+  int encoderMoveSteps = 0;
   millis_t lastEncoderTime = 0;
 } EncoderRate;
 
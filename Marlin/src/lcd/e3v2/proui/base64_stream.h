@@ -0,0 +1,71 @@
+/**
+ * Streaming Base64 decoder for the DWIN G-code thumbnail preview
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+#pragma once
+
+#include <stdint.h>
+
+/**
+ * Decode base64 text a chunk at a time, in place, with a few bytes of state.
+ * Characters outside the base64 alphabet (line breaks, '; ' comment prefixes)
+ * are skipped and '=' ends the stream, so a thumbnail can be decoded straight
+ * from G-code comment lines without collecting it into one big buffer first.
+ *
+ * Output bytes are emitted as soon as 8 bits are available, so the write
+ * position never passes the read position and the chunk can be reused as
+ * the output buffer.
+ */
+class Base64Stream {
+  private:
+    uint16_t bits;  // Bits not yet emitted (the low 'nbits' bits)
+    uint8_t nbits;
+    bool ended;
+
+    static uint8_t value(const uint8_t c) {
+      if (c >= 'A' && c <= 'Z') return c - 'A';
+      if (c >= 'a' && c <= 'z') return c - 'a' + 26;
+      if (c >= '0' && c <= '9') return c - '0' + 52;
+      if (c == '+') return 62;
+      if (c == '/') return 63;
+      return 0xFF;
+    }
+
+  public:
+    Base64Stream() { reset(); }
+
+    void reset() { bits = 0; nbits = 0; ended = false; }
+
+    // True once the '=' padding (end of data) has been seen
+    bool done() const { return ended; }
+
+    // Decode len characters of buf in place. Returns the number of bytes now at the start of buf.
+    uint16_t decode(uint8_t * const buf, const uint16_t len) {
+      uint16_t out = 0;
+      for (uint16_t i = 0; i < len && !ended; ++i) {
+        const uint8_t c = buf[i], v = value(c);
+        if (v > 63) { if (c == '=') ended = true; continue; }
+        bits = (bits << 6) | v;
+        nbits += 6;
+        if (nbits >= 8) {
+          nbits -= 8;
+          buf[out++] = uint8_t(bits >> nbits);
+          bits &= (1U << nbits) - 1;
+        }
+      }
+      return out;
+    }
+};
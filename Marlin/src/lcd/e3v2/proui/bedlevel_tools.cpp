@@ -215,6 +215,7 @@ bool BedLevelToolsClass::meshValidate() {
       */
 
       DWIN_Draw_Rectangle(1, color, start_x_px, start_y_px, end_x_px, end_y_px);
+      DWIN_TxFlush();
       safe_delay(10);
       LCD_SERIAL.flushTX();
 
@@ -235,6 +236,7 @@ bool BedLevelToolsClass::meshValidate() {
           DWIN_Draw_String(false, MeshViewer.meshfont, DWINUI::textcolor, DWINUI::backcolor, start_x_px - 2 + offset_x, start_y_px + offset_y, F("."));
         DWIN_Draw_String(false, MeshViewer.meshfont, DWINUI::textcolor, DWINUI::backcolor, start_x_px + 1 + offset_x, start_y_px + offset_y, msg);
       }
+      DWIN_TxFlush();
       safe_delay(10);
       LCD_SERIAL.flushTX();
     } // GRID_LOOP
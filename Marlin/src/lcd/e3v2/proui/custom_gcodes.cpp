@@ -28,6 +28,7 @@
 #include "../../marlinui.h"
 
 #include "dwin.h"
+#include "menus.h"
 
 #define DEBUG_OUT ENABLED(DEBUG_DWIN)
 #include "../../../core/debug_out.h"
@@ -98,6 +99,30 @@ void C250() {
   }
 #endif
 
+#ifdef PROUI_TEMP_HISTORY
+  #include "temp_history.h"
+  // Dump the temperature history as CSV, optionally only the last S<count> samples
+  void C994() {
+    tempHistory.report(parser.ushortval('S'));
+  }
+#endif
+
+// Report menu item pool use and free memory. Free memory at menu changes
+// should hold steady, since building a menu doesn't allocate.
+void C995() {
+  SERIAL_ECHOLNPGM("Menu items peak:", MenuStats.peak, "/" STRINGIFY(MENU_MAX_ITEMS), " dropped:", MenuStats.dropped,
+                   " pool bytes:", (MENU_MAX_ITEMS) * (sizeof(MenuItemPtrClass) + sizeof(CustomMenuItemClass*)));
+  SERIAL_ECHOLNPGM("Free memory:", freeMemory(), " lowest at menu change:", MenuStats.free_min);
+}
+
+#if ENABLED(DWIN_TX_STATS)
+  // Report LCD traffic
+  void C996() {
+    SERIAL_ECHOLNPGM("LCD TX packets/s:", dwinTxStats.packets_ps, " bytes/s:", dwinTxStats.bytes_ps,
+                     " total packets:", dwinTxStats.packets, " bytes:", dwinTxStats.bytes);
+  }
+#endif
+
 #if DEBUG_DWIN
   #include "../../../module/planner.h"
   void C997() {
@@ -123,6 +148,13 @@ void custom_gcode(const int16_t codenum) {
     #if HAS_LOCKSCREEN
       case 510: C510(); break;          // lock screen
     #endif
+    #ifdef PROUI_TEMP_HISTORY
+      case 994: C994(); break;          // Dump the temperature history
+    #endif
+    case 995: C995(); break;            // Report menu item pool and free memory
+    #if ENABLED(DWIN_TX_STATS)
+      case 996: C996(); break;          // Report LCD traffic
+    #endif
     #if DEBUG_DWIN
       case 997: C997(); break;          // Simulate a printer freeze
     #endif
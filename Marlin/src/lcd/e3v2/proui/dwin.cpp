@@ -671,116 +671,130 @@ void Goto_Main_Menu() {
   DWIN_UpdateLCD();
 }
 
+// Retained dashboard state. Each widget keeps what it last put on the screen
+// and only sends DWIN packets when that changes. A full redraw invalidates it.
+template<typename T>
+class DashCache {
+  T last;
+  bool valid = false;
+public:
+  bool changed(const T v) { if (valid && v == last) return false; last = v; valid = true; return true; }
+  void invalidate() { valid = false; }
+};
+
+typedef struct {
+  DashCache<float> pos[XYZ];
+  DashCache<uint8_t> pos_mode[XYZ];
+  #if HAS_HOTEND
+    DashCache<celsius_t> hotend_temp, hotend_target;
+    DashCache<int16_t> flow;
+    DashCache<uint32_t> hotend_icon;
+  #endif
+  #if HAS_HEATED_BED
+    DashCache<celsius_t> bed_temp, bed_target;
+    DashCache<uint32_t> bed_icon;
+  #endif
+  #if HAS_FAN
+    DashCache<uint8_t> fan;
+  #endif
+  DashCache<int16_t> feedrate;
+  DashCache<uint8_t> feedrate_mode;
+  DashCache<float> zoffset;
+  DashCache<uint32_t> zoffset_icon;
+  #if ALL(HAS_FILAMENT_SENSOR, PROUI_EX)
+    DashCache<uint32_t> runout_icon;
+  #endif
+  void invalidate() {
+    for (uint8_t a = 0; a < XYZ; ++a) { pos[a].invalidate(); pos_mode[a].invalidate(); }
+    TERN_(HAS_HOTEND, hotend_temp.invalidate(); hotend_target.invalidate(); flow.invalidate(); hotend_icon.invalidate());
+    TERN_(HAS_HEATED_BED, bed_temp.invalidate(); bed_target.invalidate(); bed_icon.invalidate());
+    TERN_(HAS_FAN, fan.invalidate());
+    feedrate.invalidate(); feedrate_mode.invalidate();
+    zoffset.invalidate(); zoffset_icon.invalidate();
+    #if ALL(HAS_FILAMENT_SENSOR, PROUI_EX)
+      runout_icon.invalidate();
+    #endif
+  }
+} dash_t;
+dash_t dash;
+
+// Draw a 20x20 dashboard icon over a solid background, if it's not already on screen
+void _draw_dash_icon(DashCache<uint32_t> &cache, const uint8_t icon, const uint16_t bg, const uint16_t x, const uint16_t y) {
+  if (!cache.changed(uint32_t(icon) << 16 | bg)) return;
+  DWIN_Draw_Box(1, bg, x, y, 20, 20);
+  DWINUI::Draw_Icon(icon, x, y);
+}
+
 // Draw X, Y, Z and blink if in an un-homed or un-trusted state
-void _update_axis_value(const AxisEnum axis, const uint16_t x, const uint16_t y, const bool force) {
+void _update_axis_value(const AxisEnum axis, const uint16_t x, const uint16_t y) {
   const bool draw_qmark = axis_should_home(axis),
              draw_empty = NONE(HOME_AFTER_DEACTIVATE, DISABLE_REDUCED_ACCURACY_WARNING) && !draw_qmark && !axis_is_trusted(axis);
 
-  // Check for a position change
-  static xyz_pos_t oldpos = { -1, -1, -1 };
-
   #if ALL(IS_FULL_CARTESIAN, SHOW_REAL_POS)
     const float p = planner.get_axis_position_mm(axis);
   #else
     const float p = current_position[axis];
   #endif
 
-  const bool changed = oldpos[axis] != p;
-  if (changed) { oldpos[axis] = p; }
+  // 0 = value, 1 = un-homed mark, 2 = blank
+  const uint8_t mode = (blink && draw_qmark) ? 1 : (blink && draw_empty) ? 2 : 0;
+  if (!dash.pos_mode[axis].changed(mode) && (mode || !dash.pos[axis].changed(p))) return;
+  if (mode) dash.pos[axis].invalidate(); // Show the value again when the blink ends
 
-  if (force || changed || draw_qmark || draw_empty) {
-    if (blink && draw_qmark)
-      { DWINUI::Draw_String(HMI_data.Coordinate_Color, HMI_data.Background_Color, x, y, F("  - ? -")); }
-    else if (blink && draw_empty)
-      { DWINUI::Draw_String(HMI_data.Coordinate_Color, HMI_data.Background_Color, x, y, F("       ")); }
-    else
-      { DWINUI::Draw_Signed_Float(HMI_data.Coordinate_Color, HMI_data.Background_Color, 3, 2, x, y, p); }
+  switch (mode) {
+    case 1: DWINUI::Draw_String(HMI_data.Coordinate_Color, HMI_data.Background_Color, x, y, F("  - ? -")); break;
+    case 2: DWINUI::Draw_String(HMI_data.Coordinate_Color, HMI_data.Background_Color, x, y, F("       ")); break;
+    default:
+      dash.pos[axis].changed(p);
+      DWINUI::Draw_Signed_Float(HMI_data.Coordinate_Color, HMI_data.Background_Color, 3, 2, x, y, p);
   }
 }
 
-void _draw_iconblink(bool &flag, const bool sensor, const uint8_t icon1, const uint8_t icon2, const uint16_t x, const uint16_t y) {
+void _draw_iconblink(DashCache<uint32_t> &cache, const bool sensor, const uint8_t icon1, const uint8_t icon2, const uint16_t x, const uint16_t y) {
   #if DISABLED(NO_BLINK_IND)
-    if (flag != sensor) {
-      flag = sensor;
-      if (!flag) {
-        DWIN_Draw_Box(1, HMI_data.Background_Color, x, y, 20, 20);
-        DWINUI::Draw_Icon(icon1, x, y);
-      }
-    }
-    if (flag) {
-      DWIN_Draw_Box(1, blink ? HMI_data.Selected_Color : HMI_data.Background_Color, x, y, 20, 20);
-      DWINUI::Draw_Icon(icon2, x, y);
-    }
+    _draw_dash_icon(cache, sensor ? icon2 : icon1, (sensor && blink) ? HMI_data.Selected_Color : HMI_data.Background_Color, x, y);
   #else
-    if (flag != sensor) {
-      flag = sensor;
-      DWIN_Draw_Box(1, HMI_data.Background_Color, x, y, 20, 20);
-      DWINUI::Draw_Icon(flag ? icon2 : icon1, x, y);
-    }
+    _draw_dash_icon(cache, sensor ? icon2 : icon1, HMI_data.Background_Color, x, y);
   #endif
 }
 
 void _draw_ZOffsetIcon() {
   #if HAS_LEVELING
-    static bool _leveling_active = false;
-    _draw_iconblink(_leveling_active, planner.leveling_active, ICON_Zoffset, ICON_SetZOffset, 187, 416);
+    _draw_iconblink(dash.zoffset_icon, planner.leveling_active, ICON_Zoffset, ICON_SetZOffset, 187, 416);
   #else
-    DWINUI::Draw_Icon(ICON_SetZOffset, 187, 416);
+    _draw_dash_icon(dash.zoffset_icon, ICON_SetZOffset, HMI_data.Background_Color, 187, 416);
   #endif
 }
 
 #if ALL(HAS_FILAMENT_SENSOR, PROUI_EX)
   void _draw_runout_icon() {
-    static bool _runout_active = false;
-    if (runout.enabled) { _draw_iconblink(_runout_active, FilamentSensorDevice::poll_runout_state(0), ICON_StepE, ICON_Version, 113, 416); }
-    else {
-      DWIN_Draw_Box(1, HMI_data.Background_Color, 113, 416, 20, 20);
-      DWINUI::Draw_Icon(ICON_StepE, 113, 416);
-    }
+    if (runout.enabled) { _draw_iconblink(dash.runout_icon, FilamentSensorDevice::poll_runout_state(0), ICON_StepE, ICON_Version, 113, 416); }
+    else { _draw_dash_icon(dash.runout_icon, ICON_StepE, HMI_data.Background_Color, 113, 416); }
   }
 #endif
 
 void _draw_feedrate() {
+  // 0 = percentage, 1 = speed in mm/s (blinking speed indicator)
   #if ENABLED(SHOW_SPEED_IND)
-    static bool _should_redraw;
-    if (HMI_data.SpdInd) {
-      int16_t _value;
-      if (blink) {
-        _value = feedrate_percentage;
-        DWINUI::Draw_String(DWIN_FONT_STAT, HMI_data.Indicator_Color, HMI_data.Background_Color, 116 + 4 * STAT_CHR_W + 2, 384, F(" %"));
-      }
-      else {
-        _value = CEIL(MMS_SCALED(feedrate_mm_s));
+    const uint8_t mode = HMI_data.SpdInd && !blink;
+    const int16_t value = mode ? int16_t(CEIL(MMS_SCALED(feedrate_mm_s))) : feedrate_percentage;
+    if (dash.feedrate_mode.changed(mode)) {
+      if (mode)
         DWIN_Draw_Box(1, HMI_data.Background_Color, 116 + 4 * STAT_CHR_W + 2, 384, 30, 20);
-      }
-      DWINUI::Draw_Int(DWIN_FONT_STAT, HMI_data.Indicator_Color, HMI_data.Background_Color, 3, 116 + 2 * STAT_CHR_W, 384, _value);
-      _should_redraw = true;
-    }
-    else {
-      static int16_t _feedrate = 100;
-      if (blink && _should_redraw == true) {
-        DWINUI::Draw_String(DWIN_FONT_STAT, HMI_data.Indicator_Color, HMI_data.Background_Color, 116 + 4 * STAT_CHR_W + 2, 384, F(" %"));
-        DWINUI::Draw_Int(DWIN_FONT_STAT, HMI_data.Indicator_Color, HMI_data.Background_Color, 3, 116 + 2 * STAT_CHR_W, 384, feedrate_percentage);
-      }
-      else if (_feedrate != feedrate_percentage) {
-        _feedrate = feedrate_percentage;
+      else
         DWINUI::Draw_String(DWIN_FONT_STAT, HMI_data.Indicator_Color, HMI_data.Background_Color, 116 + 4 * STAT_CHR_W + 2, 384, F(" %"));
-        DWINUI::Draw_Int(DWIN_FONT_STAT, HMI_data.Indicator_Color, HMI_data.Background_Color, 3, 116 + 2 * STAT_CHR_W, 384, _feedrate);
-      }
     }
   #else
-    static int16_t _feedrate = 100;
-    if (_feedrate != feedrate_percentage) {
-      _feedrate = feedrate_percentage;
-      DWINUI::Draw_Int(DWIN_FONT_STAT, HMI_data.Indicator_Color, HMI_data.Background_Color, 3, 116 + 2 * STAT_CHR_W, 384, _feedrate);
-    }
+    const int16_t value = feedrate_percentage;
   #endif
+  if (dash.feedrate.changed(value))
+    DWINUI::Draw_Int(DWIN_FONT_STAT, HMI_data.Indicator_Color, HMI_data.Background_Color, 3, 116 + 2 * STAT_CHR_W, 384, value);
 }
 
-void _draw_xyz_position(const bool force) {
-  _update_axis_value(X_AXIS,  27, 457, force);
-  _update_axis_value(Y_AXIS, 112, 457, force);
-  _update_axis_value(Z_AXIS, 197, 457, force);
+void _draw_xyz_position() {
+  _update_axis_value(X_AXIS,  27, 457);
+  _update_axis_value(Y_AXIS, 112, 457);
+  _update_axis_value(Z_AXIS, 197, 457);
 }
 
 void update_variable() {
@@ -788,97 +802,73 @@ void update_variable() {
     DWINUI::Draw_Int(Color_Light_Red, Color_Bg_Black, 2, DWIN_WIDTH - 6 * DWINUI::fontWidth(), 6, checkkey);
     DWINUI::Draw_Int(Color_Yellow, Color_Bg_Black, 2, DWIN_WIDTH - 3 * DWINUI::fontWidth(), 6, last_checkkey);
   #endif
-  _draw_xyz_position(false);
+  _draw_xyz_position();
 
   TERN_(CV_LASER_MODULE, if (laser_device.is_laser_device()) return;)
 
   #if HAS_HOTEND
-    static celsius_t _hotendtemp = 0, _hotendtarget = 0;
     const celsius_t hc = thermalManager.wholeDegHotend(EXT),
                     ht = thermalManager.degTargetHotend(EXT);
-    const bool _new_hotend_temp = _hotendtemp != hc,
-               _new_hotend_target = _hotendtarget != ht;
-    if (_new_hotend_temp) { _hotendtemp = hc; }
-    if (_new_hotend_target) { _hotendtarget = ht; }
+    const bool _new_hotend_temp = dash.hotend_temp.changed(hc),
+               _new_hotend_target = dash.hotend_target.changed(ht);
 
     // if hotend is near target, or heating, ICON indicates hot
-    if (thermalManager.degHotendNear(EXT, ht) || thermalManager.isHeatingHotend(EXT)) {
-      DWIN_Draw_Box(1, HMI_data.Background_Color, 9, 383, 20, 20);
-      DWINUI::Draw_Icon(ICON_SetEndTemp, 9, 383);
-    }
-    else {
-      DWIN_Draw_Box(1, HMI_data.Background_Color, 9, 383, 20, 20);
-      DWINUI::Draw_Icon(ICON_HotendTemp, 9, 383);
-    }
+    const bool hotend_hot = thermalManager.degHotendNear(EXT, ht) || thermalManager.isHeatingHotend(EXT);
+    _draw_dash_icon(dash.hotend_icon, hotend_hot ? ICON_SetEndTemp : ICON_HotendTemp, HMI_data.Background_Color, 9, 383);
   #endif // HAS_HOTEND
 
   #if HAS_HEATED_BED
-    static celsius_t _bedtemp = 0, _bedtarget = 0;
     const celsius_t bc = thermalManager.wholeDegBed(),
                     bt = thermalManager.degTargetBed();
-    const bool _new_bed_temp = _bedtemp != bc,
-               _new_bed_target = _bedtarget != bt;
-    if (_new_bed_temp) { _bedtemp = bc; }
-    if (_new_bed_target) { _bedtarget = bt; }
+    const bool _new_bed_temp = dash.bed_temp.changed(bc),
+               _new_bed_target = dash.bed_target.changed(bt);
 
     // if bed is near target, heating, or if degrees > 44, ICON indicates hot
-    if (thermalManager.degBedNear(bt) || thermalManager.isHeatingBed() || (bc > 44)) {
-      DWIN_Draw_Box(1, HMI_data.Background_Color, 9, 416, 20, 20);
-      DWINUI::Draw_Icon(ICON_BedTemp, 9, 416);
-    }
-    else {
-      DWIN_Draw_Box(1, HMI_data.Background_Color, 9, 416, 20, 20);
-      DWINUI::Draw_Icon(ICON_SetBedTemp, 9, 416);
-    }
+    const bool bed_hot = thermalManager.degBedNear(bt) || thermalManager.isHeatingBed() || (bc > 44);
+    _draw_dash_icon(dash.bed_icon, bed_hot ? ICON_BedTemp : ICON_SetBedTemp, HMI_data.Background_Color, 9, 416);
   #endif // HAS_HEATED_BED
 
   #if HAS_FAN
-    static uint8_t _fanspeed = 0;
-    const bool _new_fanspeed = _fanspeed != thermalManager.fan_speed[EXT];
-    if (_new_fanspeed) { _fanspeed = thermalManager.fan_speed[EXT]; }
+    const uint8_t fs = thermalManager.fan_speed[EXT];
+    const bool _new_fanspeed = dash.fan.changed(fs);
   #endif
 
   if (IsMenu(TuneMenu) || IsMenu(TemperatureMenu)) {
     // Tune page temperature update
-    TERN_(HAS_HOTEND, if (_new_hotend_target) { HotendTargetItem->redraw(); })
-    TERN_(HAS_HEATED_BED, if (_new_bed_target) { BedTargetItem->redraw(); })
-    TERN_(HAS_FAN, if (_new_fanspeed) { FanSpeedItem->redraw(); })
+    TERN_(HAS_HOTEND, if (_new_hotend_target) { HotendTargetItem->invalidate(); })
+    TERN_(HAS_HEATED_BED, if (_new_bed_target) { BedTargetItem->invalidate(); })
+    TERN_(HAS_FAN, if (_new_fanspeed) { FanSpeedItem->invalidate(); })
   }
 
   // Bottom temperature update
 
   #if HAS_HOTEND
     if (_new_hotend_temp)
-      { DWINUI::Draw_Int(DWIN_FONT_STAT, HMI_data.Indicator_Color, HMI_data.Background_Color, 3, 28, 384, _hotendtemp); }
+      { DWINUI::Draw_Int(DWIN_FONT_STAT, HMI_data.Indicator_Color, HMI_data.Background_Color, 3, 28, 384, hc); }
     if (_new_hotend_target)
-      { DWINUI::Draw_Int(DWIN_FONT_STAT, HMI_data.Indicator_Color, HMI_data.Background_Color, 3, 25 + 4 * STAT_CHR_W + 6, 384, _hotendtarget); }
+      { DWINUI::Draw_Int(DWIN_FONT_STAT, HMI_data.Indicator_Color, HMI_data.Background_Color, 3, 25 + 4 * STAT_CHR_W + 6, 384, ht); }
 
-    static int16_t _flow = planner.flow_percentage[EXT];
-    if (_flow != planner.flow_percentage[EXT]) {
-      _flow = planner.flow_percentage[EXT];
-      DWINUI::Draw_Signed_Int(DWIN_FONT_STAT, HMI_data.Indicator_Color, HMI_data.Background_Color, 3, 116 + 2 * STAT_CHR_W, 417, _flow);
-    }
+    const int16_t flow = planner.flow_percentage[EXT];
+    if (dash.flow.changed(flow))
+      { DWINUI::Draw_Signed_Int(DWIN_FONT_STAT, HMI_data.Indicator_Color, HMI_data.Background_Color, 3, 116 + 2 * STAT_CHR_W, 417, flow); }
   #endif
 
   #if HAS_HEATED_BED
     if (_new_bed_temp)
-      { DWINUI::Draw_Int(DWIN_FONT_STAT, HMI_data.Indicator_Color, HMI_data.Background_Color, 3, 28, 417, _bedtemp); }
+      { DWINUI::Draw_Int(DWIN_FONT_STAT, HMI_data.Indicator_Color, HMI_data.Background_Color, 3, 28, 417, bc); }
     if (_new_bed_target)
-      { DWINUI::Draw_Int(DWIN_FONT_STAT, HMI_data.Indicator_Color, HMI_data.Background_Color, 3, 25 + 4 * STAT_CHR_W + 6, 417, _bedtarget); }
+      { DWINUI::Draw_Int(DWIN_FONT_STAT, HMI_data.Indicator_Color, HMI_data.Background_Color, 3, 25 + 4 * STAT_CHR_W + 6, 417, bt); }
   #endif
 
   _draw_feedrate();
 
   #if HAS_FAN
     if (_new_fanspeed)
-      { DWINUI::Draw_Int(DWIN_FONT_STAT, HMI_data.Indicator_Color, HMI_data.Background_Color, 3, 195 + 2 * STAT_CHR_W, 384, _fanspeed); }
+      { DWINUI::Draw_Int(DWIN_FONT_STAT, HMI_data.Indicator_Color, HMI_data.Background_Color, 3, 195 + 2 * STAT_CHR_W, 384, fs); }
   #endif
 
-  static float _offset = 0;
-  if (BABY_Z_VAR != _offset) {
-    _offset = BABY_Z_VAR;
-    DWINUI::Draw_Signed_Float(DWIN_FONT_STAT, HMI_data.Indicator_Color,  HMI_data.Background_Color, 2, 2, 204, 417, _offset);
-  }
+  if (dash.zoffset.changed(BABY_Z_VAR))
+    { DWINUI::Draw_Signed_Float(DWIN_FONT_STAT, HMI_data.Indicator_Color,  HMI_data.Background_Color, 2, 2, 204, 417, BABY_Z_VAR); }
 
   #if ALL(HAS_FILAMENT_SENSOR, PROUI_EX)
     _draw_runout_icon();
@@ -1071,45 +1061,31 @@ void DWIN_Draw_Dashboard() {
   DWINUI::Draw_Icon(ICON_MaxSpeedX,  10, 454);
   DWINUI::Draw_Icon(ICON_MaxSpeedY,  95, 454);
   DWINUI::Draw_Icon(ICON_MaxSpeedZ, 180, 454);
-  _draw_xyz_position(true);
 
   DWIN_Draw_Rectangle(1, HMI_data.Bottom_Color, 0, 478, DWIN_WIDTH, 479);
 
-  TERN_(CV_LASER_MODULE, if (laser_device.is_laser_device()) return;)
-
-  #if HAS_HOTEND
-    DWINUI::Draw_Icon(ICON_HotendTemp, 9, 383);
-    DWINUI::Draw_Int(DWIN_FONT_STAT, HMI_data.Indicator_Color, HMI_data.Background_Color, 3, 28, 384, thermalManager.wholeDegHotend(EXT));
-    DWINUI::Draw_String(DWIN_FONT_STAT, HMI_data.Indicator_Color, HMI_data.Background_Color, 25 + 3 * STAT_CHR_W + 5, 384, F("/"));
-    DWINUI::Draw_Int(DWIN_FONT_STAT, HMI_data.Indicator_Color, HMI_data.Background_Color, 3, 25 + 4 * STAT_CHR_W + 6, 384, thermalManager.degTargetHotend(EXT));
-    DWIN_Draw_DegreeSymbol(HMI_data.Indicator_Color, 25 + 4 * STAT_CHR_W + 39, 384);
-
-    DWINUI::Draw_Icon(ICON_StepE, 113, 416);
-    DWINUI::Draw_Int(DWIN_FONT_STAT, HMI_data.Indicator_Color, HMI_data.Background_Color, 3, 116 + 2 * STAT_CHR_W, 417, planner.flow_percentage[EXT]);
-    DWINUI::Draw_String(DWIN_FONT_STAT, HMI_data.Indicator_Color, HMI_data.Background_Color, 116 + 5 * STAT_CHR_W + 2, 417, F("%"));
-  #endif
+  if (TERN1(CV_LASER_MODULE, !laser_device.is_laser_device())) {
+    #if HAS_HOTEND
+      DWINUI::Draw_String(DWIN_FONT_STAT, HMI_data.Indicator_Color, HMI_data.Background_Color, 25 + 3 * STAT_CHR_W + 5, 384, F("/"));
+      DWIN_Draw_DegreeSymbol(HMI_data.Indicator_Color, 25 + 4 * STAT_CHR_W + 39, 384);
+      DWINUI::Draw_Icon(ICON_StepE, 113, 416);
+      DWINUI::Draw_String(DWIN_FONT_STAT, HMI_data.Indicator_Color, HMI_data.Background_Color, 116 + 5 * STAT_CHR_W + 2, 417, F("%"));
+    #endif
 
-  #if HAS_HEATED_BED
-    DWINUI::Draw_Icon(ICON_SetBedTemp, 9, 416);
-    DWINUI::Draw_Int(DWIN_FONT_STAT, HMI_data.Indicator_Color, HMI_data.Background_Color, 3, 28, 417, thermalManager.wholeDegBed());
-    DWINUI::Draw_String(DWIN_FONT_STAT, HMI_data.Indicator_Color, HMI_data.Background_Color, 25 + 3 * STAT_CHR_W + 5, 417, F("/"));
-    DWINUI::Draw_Int(DWIN_FONT_STAT, HMI_data.Indicator_Color, HMI_data.Background_Color, 3, 25 + 4 * STAT_CHR_W + 6, 417, thermalManager.degTargetBed());
-    DWIN_Draw_DegreeSymbol(HMI_data.Indicator_Color, 25 + 4 * STAT_CHR_W + 39, 417);
-  #endif
+    #if HAS_HEATED_BED
+      DWINUI::Draw_String(DWIN_FONT_STAT, HMI_data.Indicator_Color, HMI_data.Background_Color, 25 + 3 * STAT_CHR_W + 5, 417, F("/"));
+      DWIN_Draw_DegreeSymbol(HMI_data.Indicator_Color, 25 + 4 * STAT_CHR_W + 39, 417);
+    #endif
 
-  DWINUI::Draw_Icon(ICON_Speed, 113, 383);
-  DWINUI::Draw_Int(DWIN_FONT_STAT, HMI_data.Indicator_Color, HMI_data.Background_Color, 3, 116 + 2 * STAT_CHR_W, 384, feedrate_percentage);
-  TERN_(SHOW_SPEED_IND, if (!HMI_data.SpdInd)) DWINUI::Draw_String(DWIN_FONT_STAT, HMI_data.Indicator_Color, HMI_data.Background_Color, 116 + 5 * STAT_CHR_W + 2, 384, F("%"));
+    DWINUI::Draw_Icon(ICON_Speed, 113, 383);
+    TERN_(SHOW_SPEED_IND, if (!HMI_data.SpdInd)) DWINUI::Draw_String(DWIN_FONT_STAT, HMI_data.Indicator_Color, HMI_data.Background_Color, 116 + 5 * STAT_CHR_W + 2, 384, F("%"));
 
-  #if HAS_FAN
-    DWINUI::Draw_Icon(ICON_FanSpeed, 187, 383);
-    DWINUI::Draw_Int(DWIN_FONT_STAT, HMI_data.Indicator_Color, HMI_data.Background_Color, 3, 195 + 2 * STAT_CHR_W, 384, thermalManager.fan_speed[EXT]);
-  #endif
+    TERN_(HAS_FAN, DWINUI::Draw_Icon(ICON_FanSpeed, 187, 383));
+  }
 
-  #if HAS_ZOFFSET_ITEM
-    DWINUI::Draw_Icon(planner.leveling_active ? ICON_SetZOffset : ICON_Zoffset, 187, 416);
-    DWINUI::Draw_Signed_Float(DWIN_FONT_STAT, HMI_data.Indicator_Color,  HMI_data.Background_Color, 2, 2, 204, 417, BABY_Z_VAR);
-  #endif
+  // Values and state icons are drawn from the (now empty) retained state
+  dash.invalidate();
+  update_variable();
 }
 
 // Info Menu
@@ -1315,6 +1291,7 @@ void HMI_Init() {
       DWINUI::Draw_Icon(ICON_Bar, 15, 260);
       DWIN_Draw_Rectangle(1, HMI_data.Background_Color, t, 260, 257, 280);
       DWIN_UpdateLCD();
+      DWIN_TxFlush();
       safe_delay((BOOTSCREEN_TIMEOUT) / 22);
     }
   #endif
@@ -1354,10 +1331,11 @@ void EachMomentUpdate() {
       #endif
       #if ANY(PROUI_TUNING_GRAPH, PROUI_ITEM_PLOT)
         switch (HMI_value.tempControl) {
-          OPTCODE(PIDTEMP,        case PID_EXTR_START:    { plot.update(thermalManager.wholeDegHotend(EXT)); } break)
-          OPTCODE(PIDTEMPBED,     case PID_BED_START:     { plot.update(thermalManager.wholeDegBed()); }       break)
-          OPTCODE(PIDTEMPCHAMBER, case PID_CHAMBER_START: { plot.update(thermalManager.wholeDegChamber()); }   break)
-          OPTCODE(MPCTEMP,        case MPC_STARTED:       { plot.update(thermalManager.wholeDegHotend(EXT)); } break)
+          TERN_(PIDTEMP,        case PID_EXTR_START:)
+          TERN_(PIDTEMPBED,     case PID_BED_START:)
+          TERN_(PIDTEMPCHAMBER, case PID_CHAMBER_START:)
+          TERN_(MPCTEMP,        case MPC_STARTED:)
+            plot.update(); break;
           default: break;
         }
       #endif
@@ -1434,6 +1412,8 @@ void EachMomentUpdate() {
     #endif
 
   }
+  TERN_(HAS_MESH, MeshViewer.update());
+  MenuValuesUpdate();
   DWIN_UpdateLCD();
 }
 
@@ -1519,19 +1499,23 @@ void EachMomentUpdate() {
 #endif  // AUTO_BED_LEVELING_UBL
 
 #if ENABLED(PROUI_ITEM_PLOT)
-  // Change Plot graph with scrolling
+  // Change Plot graph with scrolling right, time scale with scrolling left (with a history)
   void PlotChange() {
     EncoderState encoder_diffState = get_encoder_state();
+    #ifdef PROUI_TEMP_HISTORY
+      if (encoder_diffState == ENCODER_DIFF_CCW) {
+        plot.nextZoom();
+        DWIN_UpdateLCD();
+        return;
+      }
+    #endif
     if (encoder_diffState == ENCODER_DIFF_CW || encoder_diffState == ENCODER_DIFF_CCW) {
-      const bool change = encoder_diffState != ENCODER_DIFF_ENTER;
-      if (change) {
-        switch(HMI_value.tempControl) {
-          TERN_(MPCTEMP,        case MPC_STARTED:)
-          TERN_(PIDTEMP,        case PID_EXTR_START:) drawBedPlot(); break;
-          TERN_(PIDTEMPBED,     case PID_BED_START: TERN(PIDTEMPCHAMBER, drawChamberPlot, drawHotendPlot)(); break;)
-          TERN_(PIDTEMPCHAMBER, case PID_CHAMBER_START: drawHotendPlot(); break;)
-          default: break;
-        }
+      switch(HMI_value.tempControl) {
+        TERN_(MPCTEMP,        case MPC_STARTED:)
+        TERN_(PIDTEMP,        case PID_EXTR_START:) drawBedPlot(); break;
+        TERN_(PIDTEMPBED,     case PID_BED_START: TERN(PIDTEMPCHAMBER, drawChamberPlot, drawHotendPlot)(); break;)
+        TERN_(PIDTEMPCHAMBER, case PID_CHAMBER_START: drawHotendPlot(); break;)
+        default: break;
       }
       DWIN_UpdateLCD();
     }
@@ -1629,6 +1613,7 @@ void HMI_ReturnScreen() {
     constexpr frame_rect_t gfrm = { 30, 150, DWIN_WIDTH - 60, 160 };
     DWINUI::ClearMainArea();
     Draw_Popup_Bkgd();
+    heater_id_t _heater = EXT;
     // Draw labels, Values
     switch (HMI_value.tempControl) {
       default: return;
@@ -1657,6 +1642,7 @@ void HMI_ReturnScreen() {
           DWINUI::Draw_CenteredString(2, HMI_data.PopupTxt_Color, 92, GET_TEXT_F(MSG_TEMP_BED));
           _maxtemp = BED_MAX_TARGET;
           _target = HMI_data.BedPIDT;
+          _heater = H_BED;
           break;
       #endif
       #if ENABLED(PIDTEMPCHAMBER)
@@ -1666,10 +1652,11 @@ void HMI_ReturnScreen() {
           DWINUI::Draw_CenteredString(2, HMI_data.PopupTxt_Color, 92, GET_TEXT_F(MSG_TEMP_CHAMBER));
           _maxtemp = CHAMBER_MAX_TARGET;
           _target = HMI_data.ChamberPIDT;
+          _heater = H_CHAMBER;
           break;
       #endif
     }
-    plot.draw(gfrm, _maxtemp, _target);
+    plot.draw(gfrm, _maxtemp, _target, _heater);
     DWINUI::Draw_Int(false, 2, HMI_data.StatusTxt_Color, HMI_data.PopupBg_Color, 3, gfrm.x + 92, gfrm.y - DWINUI::fontHeight() - 6, _target);
   }
 
@@ -1679,12 +1666,17 @@ void HMI_ReturnScreen() {
 #if ENABLED(PROUI_ITEM_PLOT)
 
   void dwinDrawPlot(tempcontrol_t result) {
-    LCD_MESSAGE_F("Scroll to change between graphs");
+    #ifdef PROUI_TEMP_HISTORY
+      LCD_MESSAGE_F("Scroll right: graph, left: zoom");
+    #else
+      LCD_MESSAGE_F("Scroll to change between graphs");
+    #endif
     HMI_value.tempControl = result;
     constexpr frame_rect_t gfrm = { 30, 135, DWIN_WIDTH - 60, 160 };
     DWINUI::ClearMainArea();
     Draw_Popup_Bkgd();
     HMI_SaveProcessID(PlotProcess);
+    heater_id_t _heater = EXT;
 
     switch (result) {
       #if ENABLED(MPCTEMP)
@@ -1703,13 +1695,14 @@ void HMI_ReturnScreen() {
           DWINUI::Draw_CenteredString(3, HMI_data.PopupTxt_Color, 75, GET_TEXT_F(MSG_TEMP_BED));
           _maxtemp = BED_MAX_TARGET;
           _target = thermalManager.degTargetBed();
+          _heater = H_BED;
           break;
       #endif
       default: break;
     }
 
     DWIN_Draw_String(false, 2, HMI_data.PopupTxt_Color, HMI_data.PopupBg_Color, gfrm.x, gfrm.y - DWINUI::fontHeight() - 4, GET_TEXT_F(MSG_TARGET));
-    plot.draw(gfrm, _maxtemp, _target);
+    plot.draw(gfrm, _maxtemp, _target, _heater);
     DWINUI::Draw_Int(false, 2, HMI_data.StatusTxt_Color, HMI_data.PopupBg_Color, 3, gfrm.x + 80, gfrm.y - DWINUI::fontHeight() - 4, _target);
     DWINUI::Draw_Button(BTN_Continue, 86, 305, true);
   }
@@ -1903,7 +1896,7 @@ void DWIN_HomingDone() {
           ui.set_status(F("Mesh was cancelled"));
         }
         else {
-          Goto_MeshViewer(true);
+          Goto_MeshViewer(true, true); // Keep the points drawn while probing
         }
     }
   #endif
@@ -2215,6 +2208,7 @@ void __Os Init(){
     uVar3 = uVar2 - 5;
     DWIN_Draw_Box(0, Rectangle_Color, uVar2, uVar2 + 200, uVar4 + 117, uVar4);
     DWIN_UpdateLCD();
+    DWIN_TxFlush();
     uVar4 += 10;
     safe_delay(20);
     uVar2 = uVar3;
@@ -2226,6 +2220,7 @@ void __Os Init(){
   DWINUI::Draw_CenteredString(false, 1, Color_White, DWINUI::backcolor, 280, STRING_DISTRIBUTION_DATE);
   DWINUI::Draw_CenteredString(2, 0xffe0, 305, F("ClassicRocker883"));
   DWIN_UpdateLCD();
+  DWIN_TxFlush();
   safe_delay(300);
 }
 
@@ -2263,6 +2258,7 @@ void DWIN_RebootScreen() {
   DWIN_JPG_ShowAndCache(0);
   DWINUI::Draw_CenteredString(Color_White, 220, GET_TEXT_F(MSG_PLEASE_WAIT_REBOOT));
   DWIN_UpdateLCD();
+  DWIN_TxFlush();
   safe_delay(500);
 }
 void DWIN_RedrawDash() {
@@ -2897,14 +2893,17 @@ TERN(HAS_BED_PROBE, float, void) tram(uint8_t point OPTARG(HAS_BED_PROBE, bool s
     if (HMI_data.CalcAvg) {
       DWINUI::Draw_CenteredString(140, GET_TEXT_F(MSG_CALCULATING_AVERAGE));
       DWINUI::Draw_CenteredString(160, GET_TEXT_F(MSG_AND_RELATIVE_HEIGHTS));
+      DWIN_TxFlush();
       safe_delay(1000);
       float avg = 0.0f;
       for (uint8_t x = 0; x < 2; ++x) for (uint8_t y = 0; y < 2; ++y) avg += zval[x][y];
       avg /= 4.0f;
       for (uint8_t x = 0; x < 2; ++x) for (uint8_t y = 0; y < 2; ++y) zval[x][y] -= avg;
       MeshViewer.DrawMesh(zval, 2, 2);
+      MeshViewer.finish();
     }
     else { DWINUI::Draw_CenteredString(100, GET_TEXT_F(MSG_FINDING_TRUE_VALUE)); }
+    DWIN_TxFlush();
     safe_delay(1000);
     ui.reset_status();
 
@@ -3775,62 +3774,65 @@ void Draw_Temperature_Menu() {
 
 void Draw_MaxSpeed_Menu() {
   checkkey = Menu;
-  if (SET_MENU(MaxSpeedMenu, MSG_MAX_SPEED, 5)) {
-    BACK_ITEM(Draw_Motion_Menu);
+  static constexpr MenuItemDef items[] = {
+    BACK_DEF(Draw_Motion_Menu),
     #if HAS_X_AXIS
-      EDIT_ITEM(ICON_MaxSpeedX, MSG_VMAX_A, onDrawPFloatMenu, SetMaxSpeedX, &planner.settings.max_feedrate_mm_s[X_AXIS]);
+      EDIT_DEF(ICON_MaxSpeedX, MSG_VMAX_A, onDrawPFloatMenu, SetMaxSpeedX, &planner.settings.max_feedrate_mm_s[X_AXIS]),
     #endif
     #if HAS_Y_AXIS
-      EDIT_ITEM(ICON_MaxSpeedY, MSG_VMAX_B, onDrawPFloatMenu, SetMaxSpeedY, &planner.settings.max_feedrate_mm_s[Y_AXIS]);
+      EDIT_DEF(ICON_MaxSpeedY, MSG_VMAX_B, onDrawPFloatMenu, SetMaxSpeedY, &planner.settings.max_feedrate_mm_s[Y_AXIS]),
     #endif
     #if HAS_Z_AXIS
-      EDIT_ITEM(ICON_MaxSpeedZ, MSG_VMAX_C, onDrawPFloatMenu, SetMaxSpeedZ, &planner.settings.max_feedrate_mm_s[Z_AXIS]);
+      EDIT_DEF(ICON_MaxSpeedZ, MSG_VMAX_C, onDrawPFloatMenu, SetMaxSpeedZ, &planner.settings.max_feedrate_mm_s[Z_AXIS]),
     #endif
     #if HAS_HOTEND
-      EDIT_ITEM(ICON_MaxSpeedE, MSG_VMAX_E, onDrawPFloatMenu, SetMaxSpeedE, &planner.settings.max_feedrate_mm_s[E_AXIS]);
+      EDIT_DEF(ICON_MaxSpeedE, MSG_VMAX_E, onDrawPFloatMenu, SetMaxSpeedE, &planner.settings.max_feedrate_mm_s[E_AXIS]),
     #endif
-  }
+  };
+  SET_MENU_TABLE(MaxSpeedMenu, MSG_MAX_SPEED, items);
   UpdateMenu(MaxSpeedMenu);
 }
 
 void Draw_MaxAccel_Menu() {
   checkkey = Menu;
-  if (SET_MENU(MaxAccelMenu, MSG_ACC, 5)) {
-    BACK_ITEM(Draw_Motion_Menu);
+  static constexpr MenuItemDef items[] = {
+    BACK_DEF(Draw_Motion_Menu),
     #if HAS_X_AXIS
-      EDIT_ITEM(ICON_MaxAccX, MSG_AMAX_A, onDrawPInt32Menu, SetMaxAccelX, &planner.settings.max_acceleration_mm_per_s2[X_AXIS]);
+      EDIT_DEF(ICON_MaxAccX, MSG_AMAX_A, onDrawPInt32Menu, SetMaxAccelX, &planner.settings.max_acceleration_mm_per_s2[X_AXIS]),
     #endif
     #if HAS_Y_AXIS
-      EDIT_ITEM(ICON_MaxAccY, MSG_AMAX_B, onDrawPInt32Menu, SetMaxAccelY, &planner.settings.max_acceleration_mm_per_s2[Y_AXIS]);
+      EDIT_DEF(ICON_MaxAccY, MSG_AMAX_B, onDrawPInt32Menu, SetMaxAccelY, &planner.settings.max_acceleration_mm_per_s2[Y_AXIS]),
     #endif
     #if HAS_Z_AXIS
-      EDIT_ITEM(ICON_MaxAccZ, MSG_AMAX_C, onDrawPInt32Menu, SetMaxAccelZ, &planner.settings.max_acceleration_mm_per_s2[Z_AXIS]);
+      EDIT_DEF(ICON_MaxAccZ, MSG_AMAX_C, onDrawPInt32Menu, SetMaxAccelZ, &planner.settings.max_acceleration_mm_per_s2[Z_AXIS]),
     #endif
     #if HAS_HOTEND
-      EDIT_ITEM(ICON_MaxAccE, MSG_AMAX_E, onDrawPInt32Menu, SetMaxAccelE, &planner.settings.max_acceleration_mm_per_s2[E_AXIS]);
+      EDIT_DEF(ICON_MaxAccE, MSG_AMAX_E, onDrawPInt32Menu, SetMaxAccelE, &planner.settings.max_acceleration_mm_per_s2[E_AXIS]),
     #endif
-  }
+  };
+  SET_MENU_TABLE(MaxAccelMenu, MSG_ACC, items);
   UpdateMenu(MaxAccelMenu);
 }
 
 #if ENABLED(CLASSIC_JERK)
   void Draw_MaxJerk_Menu() {
     checkkey = Menu;
-    if (SET_MENU(MaxJerkMenu, MSG_MAX_JERK, 5)) {
-      BACK_ITEM(Draw_Motion_Menu);
+    static constexpr MenuItemDef items[] = {
+      BACK_DEF(Draw_Motion_Menu),
       #if HAS_X_AXIS
-        EDIT_ITEM(ICON_MaxSpeedJerkX, MSG_VA_JERK, onDrawPFloatMenu, SetMaxJerkX, &planner.max_jerk.x);
+        EDIT_DEF(ICON_MaxSpeedJerkX, MSG_VA_JERK, onDrawPFloatMenu, SetMaxJerkX, &planner.max_jerk.x),
       #endif
       #if HAS_Y_AXIS
-        EDIT_ITEM(ICON_MaxSpeedJerkY, MSG_VB_JERK, onDrawPFloatMenu, SetMaxJerkY, &planner.max_jerk.y);
+        EDIT_DEF(ICON_MaxSpeedJerkY, MSG_VB_JERK, onDrawPFloatMenu, SetMaxJerkY, &planner.max_jerk.y),
       #endif
       #if HAS_Z_AXIS
-        EDIT_ITEM(ICON_MaxSpeedJerkZ, MSG_VC_JERK, onDrawPFloatMenu, SetMaxJerkZ, &planner.max_jerk.z);
+        EDIT_DEF(ICON_MaxSpeedJerkZ, MSG_VC_JERK, onDrawPFloatMenu, SetMaxJerkZ, &planner.max_jerk.z),
       #endif
       #if HAS_HOTEND
-        EDIT_ITEM(ICON_MaxSpeedJerkE, MSG_VE_JERK, onDrawPFloatMenu, SetMaxJerkE, &planner.max_jerk.e);
+        EDIT_DEF(ICON_MaxSpeedJerkE, MSG_VE_JERK, onDrawPFloatMenu, SetMaxJerkE, &planner.max_jerk.e),
       #endif
-    }
+    };
+    SET_MENU_TABLE(MaxJerkMenu, MSG_MAX_JERK, items);
     UpdateMenu(MaxJerkMenu);
   }
 #endif // CLASSIC_JERK
@@ -3838,21 +3840,22 @@ void Draw_MaxAccel_Menu() {
 #if ENABLED(EDITABLE_STEPS_PER_UNIT)
   void Draw_Steps_Menu() {
     checkkey = Menu;
-    if (SET_MENU(StepsMenu, MSG_STEPS_PER_MM, 5)) {
-      BACK_ITEM(Draw_Motion_Menu);
+    static constexpr MenuItemDef items[] = {
+      BACK_DEF(Draw_Motion_Menu),
       #if HAS_X_AXIS
-        EDIT_ITEM(ICON_StepX, MSG_A_STEPS, onDrawPFloat2Menu, SetStepsX, &planner.settings.axis_steps_per_mm[X_AXIS]);
+        EDIT_DEF(ICON_StepX, MSG_A_STEPS, onDrawPFloat2Menu, SetStepsX, &planner.settings.axis_steps_per_mm[X_AXIS]),
       #endif
       #if HAS_Y_AXIS
-        EDIT_ITEM(ICON_StepY, MSG_B_STEPS, onDrawPFloat2Menu, SetStepsY, &planner.settings.axis_steps_per_mm[Y_AXIS]);
+        EDIT_DEF(ICON_StepY, MSG_B_STEPS, onDrawPFloat2Menu, SetStepsY, &planner.settings.axis_steps_per_mm[Y_AXIS]),
       #endif
       #if HAS_Z_AXIS
-        EDIT_ITEM(ICON_StepZ, MSG_C_STEPS, onDrawPFloat2Menu, SetStepsZ, &planner.settings.axis_steps_per_mm[Z_AXIS]);
+        EDIT_DEF(ICON_StepZ, MSG_C_STEPS, onDrawPFloat2Menu, SetStepsZ, &planner.settings.axis_steps_per_mm[Z_AXIS]),
       #endif
       #if HAS_HOTEND
-        EDIT_ITEM(ICON_StepE, MSG_E_STEPS, onDrawPFloat2Menu, SetStepsE, &planner.settings.axis_steps_per_mm[E_AXIS]);
+        EDIT_DEF(ICON_StepE, MSG_E_STEPS, onDrawPFloat2Menu, SetStepsE, &planner.settings.axis_steps_per_mm[E_AXIS]),
       #endif
-    }
+    };
+    SET_MENU_TABLE(StepsMenu, MSG_STEPS_PER_MM, items);
     UpdateMenu(StepsMenu);
   }
 #endif
@@ -3950,41 +3953,43 @@ void Draw_MaxAccel_Menu() {
 
   void Draw_SelectColors_Menu() {
     checkkey = Menu;
-    if (SET_MENU(SelectColorMenu, MSG_COLORS_SELECT, 21)) {
-      BACK_ITEM(Draw_Control_Menu);
-      MENU_ITEM(ICON_ResetEEPROM, MSG_RESTORE_DEFAULTS, onDrawMenuItem, RestoreDefaultColors);
-      EDIT_ITEM_F(0, "Screen Background", onDrawSelColorItem, SelColor, &HMI_data.Background_Color);
-      EDIT_ITEM_F(0, "Cursor", onDrawSelColorItem, SelColor, &HMI_data.Cursor_Color);
-      EDIT_ITEM_F(0, "Title Background", onDrawSelColorItem, SelColor, &HMI_data.TitleBg_Color);
-      EDIT_ITEM_F(0, "Title Text", onDrawSelColorItem, SelColor, &HMI_data.TitleTxt_Color);
-      EDIT_ITEM_F(0, "Text", onDrawSelColorItem, SelColor, &HMI_data.Text_Color);
-      EDIT_ITEM_F(0, "Selected", onDrawSelColorItem, SelColor, &HMI_data.Selected_Color);
-      EDIT_ITEM_F(0, "Split Line", onDrawSelColorItem, SelColor, &HMI_data.SplitLine_Color);
-      EDIT_ITEM_F(0, "Highlight", onDrawSelColorItem, SelColor, &HMI_data.Highlight_Color);
-      EDIT_ITEM_F(0, "Status Background", onDrawSelColorItem, SelColor, &HMI_data.StatusBg_Color);
-      EDIT_ITEM_F(0, "Status Text", onDrawSelColorItem, SelColor, &HMI_data.StatusTxt_Color);
-      EDIT_ITEM_F(0, "Popup Background", onDrawSelColorItem, SelColor, &HMI_data.PopupBg_Color);
-      EDIT_ITEM_F(0, "Popup Text", onDrawSelColorItem, SelColor, &HMI_data.PopupTxt_Color);
-      EDIT_ITEM_F(0, "Alert Background", onDrawSelColorItem, SelColor, &HMI_data.AlertBg_Color);
-      EDIT_ITEM_F(0, "Alert Text", onDrawSelColorItem, SelColor, &HMI_data.AlertTxt_Color);
-      EDIT_ITEM_F(0, "Percent Text", onDrawSelColorItem, SelColor, &HMI_data.PercentTxt_Color);
-      EDIT_ITEM_F(0, "Bar Fill", onDrawSelColorItem, SelColor, &HMI_data.Barfill_Color);
-      EDIT_ITEM_F(0, "Indicator value", onDrawSelColorItem, SelColor, &HMI_data.Indicator_Color);
-      EDIT_ITEM_F(0, "Coordinate value", onDrawSelColorItem, SelColor, &HMI_data.Coordinate_Color);
-      EDIT_ITEM_F(0, "Bottom Line", onDrawSelColorItem, SelColor, &HMI_data.Bottom_Color);
-    }
+    static constexpr MenuItemDef items[] = {
+      BACK_DEF(Draw_Control_Menu),
+      MENU_DEF(ICON_ResetEEPROM, MSG_RESTORE_DEFAULTS, onDrawMenuItem, RestoreDefaultColors),
+      EDIT_DEF_F(0, "Screen Background", onDrawSelColorItem, SelColor, &HMI_data.Background_Color),
+      EDIT_DEF_F(0, "Cursor", onDrawSelColorItem, SelColor, &HMI_data.Cursor_Color),
+      EDIT_DEF_F(0, "Title Background", onDrawSelColorItem, SelColor, &HMI_data.TitleBg_Color),
+      EDIT_DEF_F(0, "Title Text", onDrawSelColorItem, SelColor, &HMI_data.TitleTxt_Color),
+      EDIT_DEF_F(0, "Text", onDrawSelColorItem, SelColor, &HMI_data.Text_Color),
+      EDIT_DEF_F(0, "Selected", onDrawSelColorItem, SelColor, &HMI_data.Selected_Color),
+      EDIT_DEF_F(0, "Split Line", onDrawSelColorItem, SelColor, &HMI_data.SplitLine_Color),
+      EDIT_DEF_F(0, "Highlight", onDrawSelColorItem, SelColor, &HMI_data.Highlight_Color),
+      EDIT_DEF_F(0, "Status Background", onDrawSelColorItem, SelColor, &HMI_data.StatusBg_Color),
+      EDIT_DEF_F(0, "Status Text", onDrawSelColorItem, SelColor, &HMI_data.StatusTxt_Color),
+      EDIT_DEF_F(0, "Popup Background", onDrawSelColorItem, SelColor, &HMI_data.PopupBg_Color),
+      EDIT_DEF_F(0, "Popup Text", onDrawSelColorItem, SelColor, &HMI_data.PopupTxt_Color),
+      EDIT_DEF_F(0, "Alert Background", onDrawSelColorItem, SelColor, &HMI_data.AlertBg_Color),
+      EDIT_DEF_F(0, "Alert Text", onDrawSelColorItem, SelColor, &HMI_data.AlertTxt_Color),
+      EDIT_DEF_F(0, "Percent Text", onDrawSelColorItem, SelColor, &HMI_data.PercentTxt_Color),
+      EDIT_DEF_F(0, "Bar Fill", onDrawSelColorItem, SelColor, &HMI_data.Barfill_Color),
+      EDIT_DEF_F(0, "Indicator value", onDrawSelColorItem, SelColor, &HMI_data.Indicator_Color),
+      EDIT_DEF_F(0, "Coordinate value", onDrawSelColorItem, SelColor, &HMI_data.Coordinate_Color),
+      EDIT_DEF_F(0, "Bottom Line", onDrawSelColorItem, SelColor, &HMI_data.Bottom_Color),
+    };
+    SET_MENU_TABLE(SelectColorMenu, MSG_COLORS_SELECT, items);
     UpdateMenu(SelectColorMenu);
   }
 
   void Draw_GetColor_Menu() {
     checkkey = Menu;
-    if (SET_MENU(GetColorMenu, MSG_COLORS_GET, 5)) {
-      BACK_ITEM(DWIN_ApplyColor);
-      MENU_ITEM(ICON_Cancel, MSG_BUTTON_CANCEL, onDrawMenuItem, Draw_SelectColors_Menu);
-      MENU_ITEM(0, MSG_COLORS_RED,   onDrawGetColorItem, SetRGBColor);
-      MENU_ITEM(1, MSG_COLORS_GREEN, onDrawGetColorItem, SetRGBColor);
-      MENU_ITEM(2, MSG_COLORS_BLUE,  onDrawGetColorItem, SetRGBColor);
-    }
+    static constexpr MenuItemDef items[] = {
+      BACK_DEF(DWIN_ApplyColor),
+      MENU_DEF(ICON_Cancel, MSG_BUTTON_CANCEL, onDrawMenuItem, Draw_SelectColors_Menu),
+      MENU_DEF(0, MSG_COLORS_RED,   onDrawGetColorItem, SetRGBColor),
+      MENU_DEF(1, MSG_COLORS_GREEN, onDrawGetColorItem, SetRGBColor),
+      MENU_DEF(2, MSG_COLORS_BLUE,  onDrawGetColorItem, SetRGBColor),
+    };
+    SET_MENU_TABLE(GetColorMenu, MSG_COLORS_GET, items);
     UpdateMenu(GetColorMenu);
     DWIN_Draw_Rectangle(1, *MenuData.P_Int, 20, 315, DWIN_WIDTH - 20, 335);
   }
@@ -116,6 +116,9 @@
 #if ENABLED(CV_LASER_MODULE) && !PROUI_EX
   #error "CV_LASER_MODULE requires PROUI_EX."
 #endif
+#if ENABLED(DWIN_TX_STATS) && !HAS_CGCODE
+  #error "DWIN_TX_STATS requires HAS_CGCODE."
+#endif
 
 #if PROUI_EX
 
@@ -36,7 +36,7 @@
 #include "../../marlinui.h"
 #include "../../../sd/cardreader.h"
 #include "dwin_popup.h"
-#include "base64.h"
+#include "base64_stream.h"
 
 #if ENABLED(TJC_DISPLAY)
   #define THUMBWIDTH  180
@@ -86,17 +86,16 @@ void getValue(PGM_P const buf, PGM_P const key, float &value) {
   }
 }
 
-bool Preview::hasPreview() {
-  const char * const tbstart = PSTR("; thumbnail begin " STRINGIFY(THUMBWIDTH) "x" STRINGIFY(THUMBHEIGHT));
+#define THUMB_BEGIN "; thumbnail begin " STRINGIFY(THUMBWIDTH) "x" STRINGIFY(THUMBHEIGHT)
+
+// Scan the open file's header for print info and the thumbnail.
+// Sets thumbstart to the offset of the base64 data (0 if none) and thumbsize to its length.
+static void scanHeader() {
+  PGM_P const tbstart = PSTR(THUMB_BEGIN);
   const char *posptr = nullptr;
   uint32_t indx = 0;
   float tmp = 0;
 
-  fileprop.clears();
-  fileprop.setnames(card.filename);
-
-  card.openFileRead(fileprop.name);
-
   char buf[256];
   uint8_t nbyte = 1;
   while (!fileprop.thumbstart && nbyte > 0 && indx < 4 * sizeof(buf)) {
@@ -128,13 +127,9 @@ bool Preview::hasPreview() {
     }
   }
 
-  if (!fileprop.thumbstart) {
-    card.closefile();
-    LCD_MESSAGE_F("Thumbnail not found");
-    return false;
-  }
+  if (!fileprop.thumbstart) return;
 
-  // Get the size of the thumbnail
+  // Get the size of the thumbnail. The data starts on the next line.
   card.setIndex(fileprop.thumbstart + strlen_P(tbstart));
   for (uint8_t i = 0; i < 16; i++) {
     const char c = card.get();
@@ -142,6 +137,213 @@ bool Preview::hasPreview() {
     buf[i] = c;
   }
   fileprop.thumbsize = atoi(buf);
+  fileprop.thumbstart = card.getIndex();
+}
+
+/**
+ * Fixed header written by the bundled slicer scripts as the first line of the file:
+ *
+ *   ;PROUI_HEADER V1 TIME=420 FIL=0.329580 LAYER=0.280 MINX=94.416 MINY=94.423 MINZ=0.000
+ *     MAXX=135.567 MAXY=135.576 MAXZ=5.040 TOFS=0000001234 TLEN=5960  (all on one line)
+ *
+ * TOFS is the offset of the "; thumbnail begin" line and TLEN the length of its base64
+ * data, both 0 if there is no thumbnail. The fields are read in order from a single
+ * read of the start of the file, so no searching is needed.
+ */
+#define PROUI_HEADER_MAGIC ";PROUI_HEADER V1"
+
+static char* headerKey(char *p, PGM_P const key) {
+  while (*p == ' ') ++p;
+  const size_t len = strlen_P(key);
+  return strncmp_P(p, key, len) ? nullptr : p + len;
+}
+static bool headerValue(char *&p, PGM_P const key, float &value) {
+  if (!(p = headerKey(p, key))) return false;
+  value = strtod(p, &p);
+  return true;
+}
+static bool headerValue(char *&p, PGM_P const key, uint32_t &value) {
+  if (!(p = headerKey(p, key))) return false;
+  value = strtoul(p, &p, 10);
+  return true;
+}
+
+// Read the fixed header, if any, and verify the thumbnail it points to.
+// Return false, leaving fileprop untouched, to fall back to scanHeader().
+static bool readFixedHeader() {
+  char buf[200];
+  const int16_t nbyte = card.read(buf, sizeof(buf) - 1);
+  if (nbyte <= 0) return false;
+  buf[nbyte] = '\0';
+
+  char *p = headerKey(buf, PSTR(PROUI_HEADER_MAGIC));
+  float time, filament, layer, minx, miny, minz, maxx, maxy, maxz;
+  uint32_t tofs, tlen;
+  if (!(p
+    && headerValue(p, PSTR("TIME="), time)   && headerValue(p, PSTR("FIL="), filament)
+    && headerValue(p, PSTR("LAYER="), layer)
+    && headerValue(p, PSTR("MINX="), minx)   && headerValue(p, PSTR("MINY="), miny)   && headerValue(p, PSTR("MINZ="), minz)
+    && headerValue(p, PSTR("MAXX="), maxx)   && headerValue(p, PSTR("MAXY="), maxy)   && headerValue(p, PSTR("MAXZ="), maxz)
+    && headerValue(p, PSTR("TOFS="), tofs)   && headerValue(p, PSTR("TLEN="), tlen)
+    && ISEOL(*p)                              // Not cut off by the end of the buffer
+  )) return false;
+
+  // The thumbnail must be there and have the size this display uses
+  uint32_t thumbstart = 0;
+  if (tlen) {
+    if (tofs >= card.getFileSize()) return false;
+    PGM_P const tbstart = PSTR(THUMB_BEGIN);
+    const uint8_t len = strlen_P(tbstart);
+    card.setIndex(tofs);
+    if (card.read(buf, len) != len || strncmp_P(buf, tbstart, len)) return false;
+    for (uint8_t i = 0; i < 16 && !ISEOL(card.get()); ++i) { /* skip the size */ }
+    thumbstart = card.getIndex();
+  }
+
+  fileprop.time = time;
+  fileprop.filament = filament;
+  fileprop.layer = layer;
+  fileprop.width = maxx - minx;
+  fileprop.length = maxy - miny;
+  fileprop.height = maxz - minz;
+  fileprop.thumbstart = thumbstart;
+  fileprop.thumbsize = tlen;
+  return true;
+}
+
+// Get print info and the thumbnail location from the open file
+static void readHeader() {
+  if (readFixedHeader()) return;
+  card.setIndex(0);
+  scanHeader();
+}
+
+#if ENABLED(PROUI_PREVIEW_CACHE)
+
+  /**
+   * Per-folder cache of header scan results, kept in PREVIEW_CACHE_FILE.
+   * The file starts with a magic number, followed by a fixed table of records.
+   * Each file has one slot, picked by a hash of its name, so a lookup reads a single record.
+   * A record is only used if the file's name, size and date still match.
+   * The .IDX extension keeps it out of the media menu.
+   */
+  #define PREVIEW_CACHE_FILE    "PREVIEW.IDX"
+  #define PREVIEW_CACHE_ENTRIES 128
+
+  typedef struct {
+    char name[13];                // 8.3 name of the G-code file
+    uint32_t fsize;               // File size and FAT date/time when scanned
+    uint16_t fdate, ftime;
+    uint32_t thumbstart;          // Offset of the base64 thumbnail data, 0 for none
+    int32_t thumbsize;            // Length of the base64 thumbnail data
+    float time, filament, layer, width, height, length;
+  } preview_cache_t;
+
+  // "PV" + version + record size, so a layout change starts a new index
+  constexpr uint32_t preview_cache_magic = 0x50560200UL | sizeof(preview_cache_t);
+
+  // Get the name, size and date of the open file
+  static bool getFileStamp(const char * const name, preview_cache_t &rec) {
+    dir_t d;
+    if (!card.getDirEntry(&d)) return false;
+    strcpy(rec.name, name);
+    rec.fsize = d.fileSize;
+    rec.fdate = d.lastWriteDate;
+    rec.ftime = d.lastWriteTime;
+    return true;
+  }
+
+  static uint32_t cacheOffset(const char *name) {
+    uint16_t h = 0;
+    while (*name) h = h * 31 + *name++;
+    return sizeof(preview_cache_magic) + (h % (PREVIEW_CACHE_ENTRIES)) * sizeof(preview_cache_t);
+  }
+
+  /**
+   * Read the slot for rec and copy it to rec if it is up to date.
+   * Set valid if the index exists, so a new one doesn't have to be made.
+   */
+  static bool cacheLookup(preview_cache_t &rec, bool &valid) {
+    valid = false;
+    MediaFile idx;
+    if (!idx.open(&card.getWorkDir(), PREVIEW_CACHE_FILE, O_READ)) return false;
+
+    bool found = false;
+    uint32_t magic = 0;
+    preview_cache_t e;
+    valid = idx.read(&magic, sizeof(magic)) == sizeof(magic) && magic == preview_cache_magic
+         && idx.fileSize() == sizeof(magic) + (PREVIEW_CACHE_ENTRIES) * sizeof(e);
+    if (valid && idx.seekSet(cacheOffset(rec.name)) && idx.read(&e, sizeof(e)) == sizeof(e)) {
+      found = !strcmp(e.name, rec.name) && e.fsize == rec.fsize && e.fdate == rec.fdate && e.ftime == rec.ftime;
+      if (found) rec = e;
+    }
+    idx.close();
+    return found;
+  }
+
+  // Write rec to its slot, making a new index of empty records first if needed
+  static void cacheStore(const preview_cache_t &rec, const bool valid) {
+    MediaFile idx;
+    if (!valid) {
+      if (!idx.open(&card.getWorkDir(), PREVIEW_CACHE_FILE, O_CREAT | O_WRITE | O_TRUNC)) return;
+      const uint32_t magic = preview_cache_magic;
+      idx.write(&magic, sizeof(magic));
+      const preview_cache_t empty{};
+      for (uint8_t i = 0; i < PREVIEW_CACHE_ENTRIES; ++i) idx.write(&empty, sizeof(empty));
+    }
+    else if (!idx.open(&card.getWorkDir(), PREVIEW_CACHE_FILE, O_WRITE))
+      return;
+    if (idx.seekSet(cacheOffset(rec.name)))
+      idx.write(&rec, sizeof(rec));
+    idx.close();
+  }
+
+#endif // PROUI_PREVIEW_CACHE
+
+bool Preview::hasPreview() {
+  fileprop.clears();
+  fileprop.setnames(card.filename);
+
+  card.openFileRead(fileprop.name);
+
+  #if ENABLED(PROUI_PREVIEW_CACHE)
+    preview_cache_t rec;
+    bool valid = false;
+    const bool stamped = getFileStamp(fileprop.name, rec),
+               cached = stamped && cacheLookup(rec, valid);
+    if (cached) {
+      fileprop.thumbstart = rec.thumbstart;
+      fileprop.thumbsize = rec.thumbsize;
+      fileprop.time = rec.time;
+      fileprop.filament = rec.filament;
+      fileprop.layer = rec.layer;
+      fileprop.width = rec.width;
+      fileprop.height = rec.height;
+      fileprop.length = rec.length;
+    }
+    else {
+      readHeader();
+      if (stamped) {
+        rec.thumbstart = fileprop.thumbstart;
+        rec.thumbsize = fileprop.thumbsize;
+        rec.time = fileprop.time;
+        rec.filament = fileprop.filament;
+        rec.layer = fileprop.layer;
+        rec.width = fileprop.width;
+        rec.height = fileprop.height;
+        rec.length = fileprop.length;
+        cacheStore(rec, valid);
+      }
+    }
+  #else
+    readHeader();
+  #endif
+
+  if (!fileprop.thumbstart) {
+    card.closefile();
+    LCD_MESSAGE_F("Thumbnail not found");
+    return false;
+  }
 
   // Exit if there isn't a thumbnail
   if (!fileprop.thumbsize) {
@@ -150,19 +352,27 @@ bool Preview::hasPreview() {
     return false;
   }
 
-  uint8_t buf64[fileprop.thumbsize + 1];
-  uint16_t nread = 0;
-  while (nread < fileprop.thumbsize) {
-    const uint8_t c = card.get();
-    if (!ISEOL(c) && c != ';' && c != ' ')
-      buf64[nread++] = c;
+  card.setIndex(fileprop.thumbstart);
+
+  // Stream the thumbnail to the display SRAM. Each chunk of base64 text is decoded
+  // in place and sent as-is, so RAM use doesn't depend on the thumbnail size.
+  Base64Stream b64;
+  uint8_t chunk[128];
+  uint16_t addr = 0;
+  int32_t pending = fileprop.thumbsize;  // base64 characters still to read
+  while (pending > 0 && !b64.done()) {
+    const int16_t nread = card.read(chunk, _MIN(sizeof(chunk), size_t(pending)));
+    if (nread <= 0) break;
+    for (int16_t i = 0; i < nread; ++i) {
+      const uint8_t c = chunk[i];
+      if (!ISEOL(c) && c != ';' && c != ' ') pending--;
+    }
+    const uint16_t len = b64.decode(chunk, nread);
+    if (len) DWINUI::WriteToSRAM(addr, len, chunk);
+    addr += len;
   }
   card.closefile();
-  buf64[nread] = '\0';
-
-  uint8_t thumbdata[3 + 3 * (fileprop.thumbsize / 4)];  // Reserve space for the JPEG thumbnail
-  fileprop.thumbsize = decode_base64(buf64, thumbdata);
-  DWINUI::WriteToSRAM(0x00, fileprop.thumbsize, thumbdata);
+  fileprop.thumbsize = addr;
 
   fileprop.thumbwidth = THUMBWIDTH;
   fileprop.thumbheight = THUMBHEIGHT;
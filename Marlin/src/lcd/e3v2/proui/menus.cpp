@@ -27,9 +27,24 @@
 #include "dwin.h"
 #include "menus.h"
 
+#include <new>
+
+// Menu items are constructed in place in a static pool instead of on the heap, so
+// changing menus costs the same every time and can't fragment a small heap.
+// A slot is sized for MenuItemPtrClass, which derives from the other item classes.
+typedef struct alignas(MenuItemPtrClass) { uint8_t raw[sizeof(MenuItemPtrClass)]; } MenuItemSlot;
+static_assert(sizeof(MenuItemClass) <= sizeof(MenuItemSlot) && sizeof(CustomMenuItemClass) <= sizeof(MenuItemSlot), "MenuItemSlot is too small.");
+
+MenuItemSlot MenuItemPool[MENU_MAX_ITEMS];
+CustomMenuItemClass* MenuItems[MENU_MAX_ITEMS];
+
 int8_t MenuItemTotal = 0;
 int8_t MenuItemCount = 0;
-CustomMenuItemClass** MenuItems = nullptr;
+
+// Items whose value changed since the last MenuValuesUpdate(), one bit per item
+uint8_t MenuValuesDirty[(MENU_MAX_ITEMS + 7) / 8];
+bool MenuValuesPending = false;
+bool MenuValueOnly = false;
 MenuClass *CurrentMenu = nullptr;
 MenuClass *PreviousMenu = nullptr;
 MenuData_t MenuData;
@@ -93,6 +108,7 @@ void Draw_Menu_IntValue(uint16_t bcolor, const uint8_t line, uint8_t iNum, const
 }
 
 void onDrawMenuItem(MenuItemClass* menuitem, int8_t line) {
+  if (MenuValueOnly) return;
   if (menuitem->icon) DWINUI::Draw_Icon(menuitem->icon, ICOX, MBASE(line) - 3);
   DWINUI::Draw_String(LBLX, MBASE(line) - 1, menuitem->caption);
   DWIN_Draw_HLine(HMI_data.SplitLine_Color, 16, MYPOS(line + 1), 240);
@@ -333,33 +349,46 @@ void MenuClass::draw() {
   MenuTitle.draw();
   DWINUI::SetColors(HMI_data.Text_Color, HMI_data.Background_Color, HMI_data.TitleBg_Color);
   DWINUI::ClearMainArea();
+  MenuValuesClear();
   for (int8_t i = 0; i < MenuItemCount; i++)
     MenuItems[i]->draw(i - topline);
   Draw_Menu_Cursor(line());
   DWIN_UpdateLCD();
 }
 
+// Move the selection by as many detents as the encoder turned, up to a page. The rate
+// multiplier is for editing values, so it isn't applied here. Lines that stay on screen
+// are shifted with one display area move; only uncovered lines are drawn.
 void MenuClass::onScroll(bool dir) {
-  int8_t sel = selected;
-  if (dir) sel++; else sel--;
+  const int8_t steps = _MAX(1, _MIN(encoderRate.encoderMoveSteps, int(TROWS)));
+  int8_t sel = selected + (dir ? steps : -steps);
   LIMIT(sel, 0, MenuItemCount - 1);
-  if (sel != selected) {
-    Erase_Menu_Cursor(line());
-    DWIN_UpdateLCD();
-    if ((sel - topline) == TROWS) {
-      DWIN_Frame_AreaMove(1, DWIN_SCROLL_UP, MLINE, HMI_data.Background_Color, 0, TITLE_HEIGHT + 1, DWIN_WIDTH, STATUS_Y - 1);
-      topline++;
-      MenuItems[sel]->draw(TROWS - 1);
-    }
-    if ((sel < topline)) {
-      DWIN_Frame_AreaMove(1, DWIN_SCROLL_DOWN, MLINE, HMI_data.Background_Color, 0, TITLE_HEIGHT + 1, DWIN_WIDTH, STATUS_Y - 1);
-      topline--;
-      MenuItems[sel]->draw(0);
+  if (sel == selected) return;
+
+  Erase_Menu_Cursor(line());
+  DWIN_UpdateLCD();
+
+  // Scroll just enough to keep the selection on screen
+  int8_t top = topline;
+  if (sel - top >= TROWS) top = sel - (TROWS - 1);
+  else if (sel < top) top = sel;
+  const int8_t shift = top - topline;
+  if (shift) {
+    topline = top;
+    int8_t first = 0, last = TROWS;               // Lines to draw
+    if (ABS(shift) < TROWS) {
+      DWIN_Frame_AreaMove(1, shift > 0 ? DWIN_SCROLL_UP : DWIN_SCROLL_DOWN, ABS(shift) * MLINE, HMI_data.Background_Color, 0, TITLE_HEIGHT + 1, DWIN_WIDTH, STATUS_Y - 1);
+      if (shift > 0) first = TROWS - shift; else last = -shift;
     }
-    selected = sel;
-    Draw_Menu_Cursor(line());
-    DWIN_UpdateLCD();
+    else
+      DWINUI::ClearMainArea();                    // Page jump, nothing to reuse
+    for (int8_t l = first; l < last && topline + l < MenuItemCount; ++l)
+      MenuItems[topline + l]->draw(l);
   }
+
+  selected = sel;
+  Draw_Menu_Cursor(line());
+  DWIN_UpdateLCD();
 }
 
 void MenuClass::onClick() {
@@ -385,6 +414,11 @@ void CustomMenuItemClass::draw(int8_t line) {
   if (onDraw != nullptr) (*onDraw)(static_cast<MenuItemClass*>(this), line);
 }
 
+void CustomMenuItemClass::invalidate() {
+  SBI(MenuValuesDirty[pos >> 3], pos & 7);
+  MenuValuesPending = true;
+}
+
 void CustomMenuItemClass::redraw(bool erase/*=false*/) {
   const int8_t line = CurrentMenu->line(this->pos);
   if (erase) Erase_Menu_Text(line);
@@ -397,9 +431,7 @@ CustomMenuItemClass::CustomMenuItemClass(OnDrawItem ondraw, OnClickItem onclick)
 }
 
 void MenuItemClass::SetCaption(PGM_P const text) {
-  const uint8_t len = _MIN(sizeof(caption) - 1, strlen(text));
-  memcpy(&caption[0], text, len);
-  caption[len] = '\0';
+  caption = text ?: "";
 }
 
 MenuItemClass::MenuItemClass(uint8_t cicon, PGM_P const text, OnDrawItem ondraw, OnClickItem onclick) : CustomMenuItemClass(ondraw, onclick) {
@@ -413,11 +445,18 @@ MenuItemPtrClass::MenuItemPtrClass(uint8_t cicon, PGM_P const text, OnDrawItem o
 
 // Menu auxiliary functions ===================================================
 
+#if HAS_CGCODE
+  menu_stats_t MenuStats;
+
+  void menu_stats_t::sample() {
+    const int free = freeMemory();
+    if (free_min < 0 || free < free_min) free_min = free;
+  }
+#endif
+
+// Items own no resources, so the pool is released just by forgetting them
 void MenuItemsClear() {
-  if (MenuItems == nullptr) return;
-  for (int8_t i = 0; i < MenuItemCount; i++) delete MenuItems[i];
-  delete[] MenuItems;
-  MenuItems = nullptr;
+  MenuValuesClear();
   MenuItemCount = 0;
   MenuItemTotal = 0;
 }
@@ -425,42 +464,55 @@ void MenuItemsClear() {
 void MenuItemsPrepare(uint8_t totalitems) {
   MenuItemsClear();
   MenuItemTotal = _MIN(totalitems, MENU_MAX_ITEMS);
-  MenuItems = new CustomMenuItemClass*[totalitems];
+  TERN_(HAS_CGCODE, MenuStats.sample());
 }
 
 bool IsMenu(MenuClass* _menu) {
   return ((checkkey == Menu) && !!CurrentMenu && (CurrentMenu == _menu));
 }
 
-template<typename T>
-T* MenuItemAdd(T* menuitem) {
+template<typename T, typename... Args>
+T* MenuItemAdd(Args... args) {
+  if (MenuItemCount >= MenuItemTotal) {
+    TERN_(HAS_CGCODE, MenuStats.dropped++);
+    return nullptr;
+  }
+  T* menuitem = new (&MenuItemPool[MenuItemCount]) T(args...);
   MenuItems[MenuItemCount] = menuitem;
   menuitem->pos = MenuItemCount++;
+  TERN_(HAS_CGCODE, NOLESS(MenuStats.peak, MenuItemCount));
   return menuitem;
 }
 
 CustomMenuItemClass* MenuItemAdd(OnDrawItem ondraw/*=nullptr*/, OnClickItem onclick/*=nullptr*/) {
-  if (MenuItemCount < MenuItemTotal) {
-    CustomMenuItemClass* menuitem = new CustomMenuItemClass(ondraw, onclick);
-    return MenuItemAdd(menuitem);
-  }
-  else return nullptr;
+  return MenuItemAdd<CustomMenuItemClass>(ondraw, onclick);
 }
 
 MenuItemClass* MenuItemAdd(uint8_t cicon, PGM_P const text/*=nullptr*/, OnDrawItem ondraw/*=nullptr*/, OnClickItem onclick/*=nullptr*/) {
-  if (MenuItemCount < MenuItemTotal) {
-    MenuItemClass* menuitem = new MenuItemClass(cicon, text, ondraw, onclick);
-    return MenuItemAdd(menuitem);
-  }
-  else return nullptr;
+  return MenuItemAdd<MenuItemClass>(cicon, text, ondraw, onclick);
 }
 
 MenuItemClass* EditItemAdd(uint8_t cicon, PGM_P const text, OnDrawItem ondraw, OnClickItem onclick, void* val) {
-  if (MenuItemCount < MenuItemTotal) {
-    MenuItemClass* menuitem = new MenuItemPtrClass(cicon, text, ondraw, onclick, val);
-    return MenuItemAdd(menuitem);
+  return MenuItemAdd<MenuItemPtrClass>(cicon, text, ondraw, onclick, val);
+}
+
+void MenuValuesClear() {
+  ZERO(MenuValuesDirty);
+  MenuValuesPending = false;
+}
+
+void MenuValuesUpdate() {
+  if (!MenuValuesPending) return;
+  if (CurrentMenu && checkkey == Menu) {
+    MenuValueOnly = true;
+    for (int8_t l = 0; l < TROWS; ++l) {
+      const int8_t i = CurrentMenu->topline + l;
+      if (i >= MenuItemCount) break;
+      if (TEST(MenuValuesDirty[i >> 3], i & 7)) MenuItems[i]->draw(l);
+    }
+    MenuValueOnly = false;
   }
-  else return nullptr;
+  MenuValuesClear();
 }
 
 void InitMenu() {
@@ -478,6 +530,16 @@ bool SetMenu(MenuClass* &menu, FSTR_P title, uint8_t totalitems) {
   return NotCurrent;
 }
 
+bool SetMenu(MenuClass* &menu, FSTR_P title, const MenuItemDef * const table, const uint8_t count) {
+  const bool NotCurrent = SetMenu(menu, title, count);
+  if (NotCurrent)
+    for (uint8_t i = 0; i < count; ++i) {
+      const MenuItemDef &item = table[i];
+      MenuItemAdd<MenuItemPtrClass>(item.icon, item.caption, item.onDraw, item.onClick, item.value);
+    }
+  return NotCurrent;
+}
+
 void ResetMenu(MenuClass* &menu) {
   if (menu) {
     menu->topline = 0;
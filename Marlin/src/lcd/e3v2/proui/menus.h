@@ -25,8 +25,9 @@
 #define MENU_CHAR_LIMIT  24
 
 #ifndef MENU_MAX_ITEMS
-  #define MENU_MAX_ITEMS 100
+  #define MENU_MAX_ITEMS 100  // Size of the static menu item pool (about 40 bytes of RAM per item)
 #endif
+static_assert(MENU_MAX_ITEMS <= 127, "MENU_MAX_ITEMS must be 127 or less.");
 
 typedef struct {
   int32_t MaxValue     = 0;        // Auxiliar max integer/scaled float value
@@ -72,12 +73,13 @@ public:
   virtual ~CustomMenuItemClass(){};
   virtual void draw(int8_t line);
   void redraw(bool erase=false);
+  void invalidate();                  // Schedule a redraw of the value column only
 };
 
 class MenuItemClass: public CustomMenuItemClass {
 public:
   uint8_t icon = 0;
-  char caption[MENU_CHAR_LIMIT] = "";
+  PGM_P caption = "";                 // Points to the caption in flash, never copied
   rect_t frame = {0};
   using CustomMenuItemClass::CustomMenuItemClass;
   MenuItemClass(uint8_t cicon, PGM_P const text=nullptr, OnDrawItem ondraw=nullptr, OnClickItem onclick=nullptr);
@@ -182,7 +184,29 @@ void ReDrawMenu(bool force = false);
 // Redraw selected menu item
 void ReDrawItem();
 
-// Clear MenuItems array and free MenuItems elements
+// Redraw the value column of invalidated items that are on screen.
+// Called once per EachMomentUpdate() pass, so repeated changes are drawn once.
+void MenuValuesUpdate();
+
+// Forget pending value redraws (after a full menu draw)
+void MenuValuesClear();
+
+// True while MenuValuesUpdate() is drawing. Item draw functions skip the icon and caption.
+extern bool MenuValueOnly;
+
+#if HAS_CGCODE
+  // Menu item pool use and free memory, reported by C995
+  typedef struct {
+    uint8_t peak = 0;       // Most items used by one menu
+    uint16_t dropped = 0;   // Items that didn't fit in the menu
+    int free_min = -1;      // Lowest free memory seen when building a menu (-1 = none yet)
+    void sample();
+  } menu_stats_t;
+
+  extern menu_stats_t MenuStats;
+#endif
+
+// Clear MenuItems array and release MenuItems elements
 void MenuItemsClear();
 
 // Prepare MenuItems array
@@ -191,6 +215,34 @@ void MenuItemsPrepare(uint8_t totalitems);
 // Is the current menu = menu?
 bool IsMenu(MenuClass* menu);
 
+// Static menu tables =========================================================
+//
+// A menu whose items are fixed at compile time can be declared as a constexpr
+// table in flash and opened with SET_MENU_TABLE instead of chained MenuItemAdd
+// calls. Menus with runtime content (file lists, per-extruder values) stay on
+// the MenuItemAdd path.
+
+typedef struct {
+  uint8_t icon;
+  PGM_P caption;
+  OnDrawItem onDraw;
+  OnClickItem onClick;
+  void *value;
+} MenuItemDef;
+
+// Table captions must be constant, and ProUI has no language menu, so use the primary language
+#define MENU_TEXT(MSG) GET_LANG(LCD_LANGUAGE)::MSG
+
+#define BACK_DEF(H)             { ICON_Back, MENU_TEXT(MSG_BUTTON_BACK), onDrawMenuItem, H, nullptr }
+#define MENU_DEF(I,L,D,C)       { I, MENU_TEXT(L), D, C, nullptr }
+#define EDIT_DEF(I,L,D,C,V)     { I, MENU_TEXT(L), D, C, V }
+#define EDIT_DEF_F(I,L,D,C,V)   { I, L, D, C, V }
+
+#define SET_MENU_TABLE(M,L,T) SetMenu(M, GET_TEXT_F(L), T, COUNT(T))
+
+// Create a new menu from a table
+bool SetMenu(MenuClass* &menu, FSTR_P title, const MenuItemDef * const table, const uint8_t count);
+
 // Add elements to the MenuItems array
 CustomMenuItemClass* MenuItemAdd(OnDrawItem ondraw=nullptr, OnClickItem onclick=nullptr);
 MenuItemClass* MenuItemAdd(uint8_t cicon, PGM_P const text=nullptr, OnDrawItem ondraw=nullptr, OnClickItem onclick=nullptr);
@@ -33,6 +33,7 @@
 #endif
 
 bool meshredraw;      // Redraw mesh points
+bool meshkeep;        // Keep the points already on screen (after G29)
 uint8_t sizex, sizey; // Mesh XY size
 uint8_t rmax;         // Maximum radius
 #define margin 25     // XY Margins
@@ -44,35 +45,53 @@ uint8_t rmax;         // Maximum radius
 #define px(xp) (margin + (xp) * (width) / (sizex - 1))
 #define py(yp) (30 + DWIN_WIDTH - margin - (yp) * (width) / (sizey - 1))
 
+// Points drawn per EachMomentUpdate. The TJC clone drops commands that
+// arrive too fast, so it gets a single point, circle and label together,
+// every MESH_TJC_DRAW_MS.
+#define MESH_DRAW_POINTS TERN(TJC_DISPLAY, 1, 4)
+#define MESH_TJC_DRAW_MS 100
+#define MESH_UNDRAWN INT16_MIN
+
+// What is on screen: the value (z * 100) of each circle and the labels still to draw
+int16_t meshshown[GRID_MAX_POINTS_X][GRID_MAX_POINTS_Y];
+Flags<GRID_MAX_POINTS> meshlabel;
+uint8_t meshdrawkey;
+millis_t meshnext_ms;
+
 MeshViewerClass MeshViewer;
 
 float MeshViewerClass::max, MeshViewerClass::min;
+const float (*MeshViewerClass::zsource)[GRID_MAX_POINTS_Y] = nullptr;
+uint8_t MeshViewerClass::drawpass;
+uint16_t MeshViewerClass::drawindex;
 
 void MeshViewerClass::DrawMeshGrid(const uint8_t csizex, const uint8_t csizey) {
+  zsource = nullptr;
   sizex = csizex;
   sizey = csizey;
   rmax = _MIN(margin - 2, 0.5*(width)/(sizex - 1));
   min = 100;
   max = -100;
+  for (uint8_t x = 0; x < GRID_MAX_POINTS_X; ++x)
+    for (uint8_t y = 0; y < GRID_MAX_POINTS_Y; ++y) meshshown[x][y] = MESH_UNDRAWN;
+  meshlabel.reset();
   DWINUI::ClearMainArea();
   DWIN_Draw_Rectangle(0, HMI_data.PopupTxt_Color, px(0), py(0), px(sizex - 1), py(sizey - 1));
   for (uint8_t x = 1; x < sizex - 1; ++x) DWIN_Draw_VLine(HMI_data.PopupBg_Color, px(x), py(sizey - 1), width);
   for (uint8_t y = 1; y < sizey - 1; ++y) DWIN_Draw_HLine(HMI_data.PopupBg_Color, px(0), py(y), width);
 }
 
-void MeshViewerClass::DrawMeshPoint(const uint8_t x, const uint8_t y, const float z) {
-  if (isnan(z)) return;
-
-  TERN_(HAS_BACKLIGHT_TIMEOUT, ui.refresh_backlight_timeout();)
-
-  const uint8_t fs = DWINUI::fontWidth(MeshViewer.meshfont);
-  const int16_t v = round(z * 100);
-  NOLESS(max, z); NOMORE(min, z);
-
+void MeshViewerClass::DrawPointCircle(const uint8_t x, const uint8_t y, const int16_t v) {
   const uint16_t color = DWINUI::RainbowInt(v, zmin, zmax);
   DWINUI::Draw_FillCircle(color, px(x), py(y), r(_MAX(_MIN(v, zmax), zmin)));
-  TERN_(TJC_DISPLAY, delay(100));
+  meshshown[x][y] = v;
+  meshlabel.set(x * (GRID_MAX_POINTS_Y) + y);
+}
 
+void MeshViewerClass::DrawPointLabel(const uint8_t x, const uint8_t y, const float z) {
+  meshlabel.clear(x * (GRID_MAX_POINTS_Y) + y);
+  const uint8_t fs = DWINUI::fontWidth(MeshViewer.meshfont);
+  const int16_t v = meshshown[x][y];
   const uint16_t fy = py(y) - fs;
   if (sizex < TERN(TJC_DISPLAY, 8, 9)) {
     if (v == 0) DWINUI::Draw_Float(MeshViewer.meshfont, 1, 2, px(x) - 2 * fs, fy, 0);
@@ -91,18 +110,84 @@ void MeshViewerClass::DrawMeshPoint(const uint8_t x, const uint8_t y, const floa
     }
     DWIN_Draw_String(false, MeshViewer.meshfont, DWINUI::textcolor, DWINUI::backcolor, px(x) - 2 * fs, fy, msg);
   }
-  SERIAL_FLUSH();
 }
 
-void MeshViewerClass::DrawMesh(const bed_mesh_t zval, const uint8_t csizex, const uint8_t csizey) {
-  DrawMeshGrid(csizex, csizey);
-  for (uint8_t y = 0; y < csizey; ++y) {
+// Draw a single point right away, as it is probed. Unchanged points are skipped.
+void MeshViewerClass::DrawMeshPoint(const uint8_t x, const uint8_t y, const float z) {
+  if (isnan(z)) return;
+
+  TERN_(HAS_BACKLIGHT_TIMEOUT, ui.refresh_backlight_timeout();)
+
+  NOLESS(max, z); NOMORE(min, z);
+
+  const int16_t v = round(z * 100);
+  if (meshshown[x][y] == v) return;
+  DrawPointCircle(x, y, v);
+  DrawPointLabel(x, y, z);
+}
+
+// Start drawing a whole mesh. The circles go first, then the labels, a few
+// points per update() so the UI keeps running. With changed_only the grid
+// already on screen is kept and only points with a new value are redrawn.
+void MeshViewerClass::DrawMesh(const bed_mesh_t zval, const uint8_t csizex, const uint8_t csizey, const bool changed_only/*=false*/) {
+  if (!changed_only || csizex != sizex || csizey != sizey) DrawMeshGrid(csizex, csizey);
+  min = 100;
+  max = -100;
+  for (uint8_t x = 0; x < csizex; ++x)
+    for (uint8_t y = 0; y < csizey; ++y)
+      if (!isnan(zval[x][y])) { NOLESS(max, zval[x][y]); NOMORE(min, zval[x][y]); }
+  zsource = zval;
+  drawpass = 0;
+  drawindex = 0;
+  meshdrawkey = checkkey;
+  meshnext_ms = 0;
+}
+
+void MeshViewerClass::update() {
+  if (!zsource) return;
+  if (checkkey != meshdrawkey) { zsource = nullptr; return; } // The screen was left
+  #if ENABLED(TJC_DISPLAY)
+    const millis_t ms = millis();
+    if (PENDING(ms, meshnext_ms)) return;
+    meshnext_ms = ms + MESH_TJC_DRAW_MS;
+  #endif
+  TERN_(HAS_BACKLIGHT_TIMEOUT, ui.refresh_backlight_timeout();)
+  const uint16_t count = sizex * sizey;
+  for (uint8_t budget = MESH_DRAW_POINTS; budget && zsource;) {
+    if (drawindex >= count) {
+      drawindex = 0;
+      if (++drawpass > 1) { zsource = nullptr; break; }
+    }
+    const uint8_t x = drawindex % sizex, y = drawindex / sizex;
+    ++drawindex;
+    const float z = zsource[x][y];
+    if (isnan(z)) continue;
+    if (drawpass == 0) {
+      const int16_t v = round(z * 100);
+      if (meshshown[x][y] != v) {
+        DrawPointCircle(x, y, v);
+        TERN_(TJC_DISPLAY, DrawPointLabel(x, y, z));
+        --budget;
+      }
+    }
+    else if (meshlabel.test(x * (GRID_MAX_POINTS_Y) + y)) {
+      DrawPointLabel(x, y, z);
+      --budget;
+    }
+  }
+}
+
+// Complete a pending draw before something else is drawn over the mesh
+void MeshViewerClass::finish() {
+  while (zsource) {
     hal.watchdog_refresh();
-    for (uint8_t x = 0; x < csizex; ++x) DrawMeshPoint(x, y, zval[x][y]);
+    meshnext_ms = 0;
+    update();
+    DWIN_TxService();
   }
 }
 
-void MeshViewerClass::Draw(const bool withsave/*=false*/, const bool redraw/*=true*/) {
+void MeshViewerClass::Draw(const bool withsave/*=false*/, const bool redraw/*=true*/, const bool changed_only/*=false*/) {
   Title.ShowCaption(GET_TEXT_F(MSG_MESH_VIEWER));
 
   const bool see_mesh = TERN0(USE_GRID_MESHVIEWER, bedLevelTools.view_mesh);
@@ -113,11 +198,12 @@ void MeshViewerClass::Draw(const bool withsave/*=false*/, const bool redraw/*=tr
     #endif
   }
   else {
-    if (redraw) DrawMesh(bedlevel.z_values, GRID_MAX_POINTS_X, GRID_MAX_POINTS_Y);
+    if (redraw) DrawMesh(bedlevel.z_values, GRID_MAX_POINTS_X, GRID_MAX_POINTS_Y, changed_only);
     else DWINUI::Draw_Box(1, HMI_data.Background_Color, { 89, 305, 99, 38 });
   }
 
   if (withsave) {
+    if (changed_only) DWIN_Draw_Box(1, HMI_data.Background_Color, 0, 300, DWIN_WIDTH, 48); // Clear the Cancel button left by G29
     DWIN_Draw_Box(1, HMI_data.Background_Color, 120, 300, 33, 48); // Draw black box to fill previous button select_box
     DWINUI::Draw_Button(BTN_Save, 26, 305);
     DWINUI::Draw_Button(BTN_Continue, 146, 305);
@@ -148,14 +234,16 @@ void SaveMesh() {
   #endif
 }
 
-void Draw_MeshViewer() { MeshViewer.Draw(true, meshredraw); }
+void Draw_MeshViewer() { MeshViewer.Draw(true, meshredraw, meshkeep); meshkeep = false; }
 
 void OnClick_MeshViewer() { if (HMI_flag.select_flag) SaveMesh(); HMI_ReturnScreen(); }
 
-void Goto_MeshViewer(const bool redraw) {
+void Goto_MeshViewer(const bool redraw, const bool changed_only/*=false*/) {
   meshredraw = redraw;
+  meshkeep = changed_only;
   if (leveling_is_valid()) { Goto_Popup(Draw_MeshViewer, OnClick_MeshViewer); }
   else { HMI_ReturnScreen(); }
+  meshkeep = false;
 }
 
 #endif // DWIN_LCD_PROUI && HAS_MESH
@@ -21,16 +21,25 @@
 #pragma once
 
 class MeshViewerClass {
+private:
+  static const float (*zsource)[GRID_MAX_POINTS_Y];  // Mesh being drawn by update()
+  static uint8_t drawpass;                            // 0: circles, 1: labels
+  static uint16_t drawindex;                          // Next point of the pass
+  static void DrawPointCircle(const uint8_t x, const uint8_t y, const int16_t v);
+  static void DrawPointLabel(const uint8_t x, const uint8_t y, const float z);
 public:
   const uint8_t meshfont = TERN(TJC_DISPLAY, font8x16, font6x12);
   static float max, min;
   static void DrawMeshGrid(const uint8_t csizex, const uint8_t csizey);
   static void DrawMeshPoint(const uint8_t x, const uint8_t y, const float z);
-  static void Draw(const bool withsave=false, const bool redraw=true);
-  static void DrawMesh(const bed_mesh_t zval, const uint8_t csizex, const uint8_t csizey);
+  static void Draw(const bool withsave=false, const bool redraw=true, const bool changed_only=false);
+  static void DrawMesh(const bed_mesh_t zval, const uint8_t csizex, const uint8_t csizey, const bool changed_only=false);
+  static bool drawing() { return zsource != nullptr; }
+  static void update();
+  static void finish();
 };
 
 extern MeshViewerClass MeshViewer;
 
 void SaveMesh();
-void Goto_MeshViewer(const bool redraw);
+void Goto_MeshViewer(const bool redraw, const bool changed_only=false);
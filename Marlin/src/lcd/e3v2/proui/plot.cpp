@@ -34,33 +34,119 @@ Plot plot;
 
 Plot::PlotData Plot::data;
 
-void Plot::draw(const frame_rect_t &frame, const_celsius_float_t max, const_celsius_float_t ref/*=0*/) {
+#define PLOT_GRID     60 // Columns between grid lines
+
+#ifdef PROUI_TEMP_HISTORY
+
+#define PLOT_ZOOM_MAX 8
+
+void Plot::draw(const frame_rect_t &frame, const_celsius_float_t max, const_celsius_float_t ref, const heater_id_t heater) {
+  data.graphframe = frame;
+  data.heater = heater;
+  data.scale = frame.h / max;
+  data.x2 = frame.x + frame.w - 1;
+  data.y2 = frame.y + frame.h - 1;
+  data.r = LROUND((data.y2) - ref * data.scale);
+  DWINUI::Draw_Box(0, Color_White, DWINUI::ExtendFrame(frame, 1));
+  render();
+}
+
+// Screen row for a temperature in tenths of a degree, kept inside the frame
+static uint16_t plotY(const int16_t t, const uint16_t y1, const uint16_t y2, const float scale) {
+  const int32_t y = LROUND(y2 - t * 0.1f * scale);
+  return constrain(y, int32_t(y1), int32_t(y2));
+}
+
+// Draw one column of the trace, spanning the lowest to the highest sample
+// it covers. The range is stretched to the previous sample so the trace
+// stays joined, and each column costs a single line however zoomed out.
+void Plot::drawColumn(const uint16_t x, const int32_t column) {
+  const int32_t first = column * data.zoom,                     // Oldest sample in the column
+                oldest = int32_t(tempHistory.total() - tempHistory.count());
+  if (first < oldest) return;
+  const uint16_t age = tempHistory.total() - 1 - first;         // Age of the oldest sample
+  int16_t lo = tempHistory.get(age, data.heater), hi = lo;
+  for (uint8_t i = 1; i < data.zoom; ++i) {
+    const int16_t t = tempHistory.get(age - i, data.heater);
+    NOMORE(lo, t); NOLESS(hi, t);
+  }
+  const uint16_t y1 = data.graphframe.y;
+  uint16_t top = plotY(hi, y1, data.y2, data.scale), bottom = plotY(lo, y1, data.y2, data.scale);
+  if (first - data.zoom >= oldest) { NOMORE(top, data.yP); NOLESS(bottom, data.yP); }
+  if (top == bottom) DWIN_Draw_Point(Color_Yellow, 1, 1, x, top);
+  else DWIN_Draw_VLine(Color_Yellow, x, top, bottom - top + 1);
+  data.yP = plotY(tempHistory.get(age - data.zoom + 1, data.heater), y1, data.y2, data.scale);
+}
+
+// Draw the whole plot from the temperature history, newest sample at the right
+void Plot::render() {
+  DWINUI::Draw_Box(1, Plot_Bg_Color, data.graphframe);
+  data.column = tempHistory.total() / data.zoom;
+  const int32_t start = int32_t(data.column) - data.graphframe.w;
+  for (uint16_t c = 0; c < data.graphframe.w; ++c)
+    if (start + c >= 0 && (start + c) % PLOT_GRID == 0)
+      DWIN_Draw_VLine(Line_Color, data.graphframe.x + c, data.graphframe.y, data.graphframe.h);
+  DWIN_Draw_HLine(Color_Red, data.graphframe.x, data.r, data.graphframe.w);
+  for (uint16_t c = 0; c < data.graphframe.w; ++c)
+    if (start + c >= 0) drawColumn(data.graphframe.x + c, start + c);
+}
+
+// Scroll in the columns completed since the last call
+void Plot::update() {
+  if (!data.scale) { return; }
+  const uint32_t column = tempHistory.total() / data.zoom;
+  if (column - data.column > data.graphframe.w) return render();
+  for (; data.column < column; ++data.column) {
+    DWIN_Frame_AreaMove(1, 0, 1, Plot_Bg_Color, data.graphframe.x, data.graphframe.y, data.x2, data.y2);
+    if ((data.column % PLOT_GRID) == 0) DWIN_Draw_VLine(Line_Color, data.x2, data.graphframe.y, data.graphframe.h);
+    DWIN_Draw_Point(Color_Red, 1, 1, data.x2, data.r);
+    drawColumn(data.x2, data.column);
+  }
+  TERN_(HAS_BACKLIGHT_TIMEOUT, ui.refresh_backlight_timeout());
+}
+
+// Cycle the time scale through 1, 2, 4 and 8 samples per column
+void Plot::nextZoom() {
+  data.zoom = data.zoom < PLOT_ZOOM_MAX ? data.zoom * 2 : 1;
+  if (data.scale) render();
+}
+
+#else // !PROUI_TEMP_HISTORY
+
+// Without a history the plot is drawn live, one point per update, and starts empty
+
+void Plot::draw(const frame_rect_t &frame, const_celsius_float_t max, const_celsius_float_t ref, const heater_id_t heater) {
   data.graphframe = frame;
+  data.heater = heater;
   data.graphpoints = 0;
   data.scale = frame.h / max;
   data.x2 = frame.x + frame.w - 1;
   data.y2 = frame.y + frame.h - 1;
   data.r = LROUND((data.y2) - ref * data.scale);
   DWINUI::Draw_Box(1, Plot_Bg_Color, frame);
-  for (uint8_t i = 1; i < 4; i++) if (i * 60 < frame.w) DWIN_Draw_VLine(Line_Color, i * 60 + frame.x, frame.y, frame.h);
+  for (uint8_t i = 1; i < 4; i++) if (i * PLOT_GRID < frame.w) DWIN_Draw_VLine(Line_Color, i * PLOT_GRID + frame.x, frame.y, frame.h);
   DWINUI::Draw_Box(0, Color_White, DWINUI::ExtendFrame(frame, 1));
   DWIN_Draw_HLine(Color_Red, frame.x, data.r, frame.w);
 }
 
-void Plot::update(const_celsius_float_t value) {
+void Plot::update() {
   if (!data.scale) { return; }
+  celsius_t value;
+  switch (data.heater) {
+    OPTCODE(HAS_TEMP_BED,     case H_BED:     value = thermalManager.wholeDegBed(); break)
+    OPTCODE(HAS_TEMP_CHAMBER, case H_CHAMBER: value = thermalManager.wholeDegChamber(); break)
+    default: value = TERN(HAS_TEMP_HOTEND, thermalManager.wholeDegHotend(data.heater), 0); break;
+  }
   const uint16_t y = LROUND((data.y2) - value * data.scale);
   if (data.graphpoints < data.graphframe.w) {
-    if (data.graphpoints < 1) {
+    if (data.graphpoints < 1)
       DWIN_Draw_Point(Color_Yellow, 1, 1, data.graphframe.x, y);
-    }
-    else {
+    else
       DWIN_Draw_Line(Color_Yellow, data.graphpoints + data.graphframe.x - 1, data.yP, data.graphpoints + data.graphframe.x, y);
-    }
   }
   else {
     DWIN_Frame_AreaMove(1, 0, 1, Plot_Bg_Color, data.graphframe.x, data.graphframe.y, data.x2, data.y2);
-    if ((data.graphpoints % 60) == 0) DWIN_Draw_VLine(Line_Color, data.x2 - 1, data.graphframe.y + 1, data.graphframe.h - 2);
+    if ((data.graphpoints % PLOT_GRID) == 0) DWIN_Draw_VLine(Line_Color, data.x2 - 1, data.graphframe.y + 1, data.graphframe.h - 2);
     DWIN_Draw_Point(Color_Red, 1, 1, data.x2 - 1, data.r);
     DWIN_Draw_Line(Color_Yellow, data.x2 - 2, data.yP, data.x2 - 1, y);
   }
@@ -69,4 +155,6 @@ void Plot::update(const_celsius_float_t value) {
   TERN_(HAS_BACKLIGHT_TIMEOUT, ui.refresh_backlight_timeout());
 }
 
+#endif // !PROUI_TEMP_HISTORY
+
 #endif // DWIN_LCD_PROUI && PROUI_TUNING_GRAPH || PROUI_ITEM_PLOT
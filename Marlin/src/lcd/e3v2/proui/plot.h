@@ -22,17 +22,35 @@
 #pragma once
 
 #include "dwinui.h"
+#include "../../../module/temperature.h"
+#ifdef PROUI_TEMP_HISTORY
+  #include "temp_history.h"
+#endif
 
 class Plot {
 public:
-  static void draw(const frame_rect_t &frame, const_celsius_float_t max, const_celsius_float_t ref=0);
-  static void update(const_celsius_float_t value);
+  static void draw(const frame_rect_t &frame, const_celsius_float_t max, const_celsius_float_t ref, const heater_id_t heater);
+  static void update();
+  #ifdef PROUI_TEMP_HISTORY
+    static void nextZoom();
+  #endif
 
 private:
+  #ifdef PROUI_TEMP_HISTORY
+    static void render();
+    static void drawColumn(const uint16_t x, const int32_t column);
+  #endif
   static struct PlotData {
-    uint16_t graphpoints, r, x2, y2, yP = 0;
+    uint16_t r, x2, y2, yP = 0;
     frame_rect_t graphframe = {0};
     float scale = 0;
+    heater_id_t heater = H_E0;
+    #ifdef PROUI_TEMP_HISTORY
+      uint8_t zoom = 1;   // Samples per column
+      uint32_t column;    // Next column to draw, counted from the first sample
+    #else
+      uint16_t graphpoints;
+    #endif
   } data;
 };
 
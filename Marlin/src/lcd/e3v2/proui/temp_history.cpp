@@ -0,0 +1,77 @@
+/**
+ * Temperature history for the DWIN plot
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "../../../inc/MarlinConfig.h"
+
+#if ENABLED(DWIN_LCD_PROUI) && defined(PROUI_TEMP_HISTORY)
+
+#include "temp_history.h"
+#include "../../../module/motion.h"
+
+TempHistory tempHistory;
+
+temp_sample_t TempHistory::samples[PROUI_TEMP_HISTORY];
+uint16_t TempHistory::head, TempHistory::used;
+uint32_t TempHistory::recorded;
+millis_t TempHistory::next_ms;
+
+// Called after every temperature reading. Only stores one in TEMP_HISTORY_INTERVAL.
+void TempHistory::record() {
+  const millis_t ms = millis();
+  if (PENDING(ms, next_ms)) return;
+  next_ms = ms + TEMP_HISTORY_INTERVAL;
+
+  temp_sample_t &s = samples[head];
+  TERN_(HAS_TEMP_HOTEND,  s.hotend  = LROUND(thermalManager.degHotend(active_extruder) * 10));
+  TERN_(HAS_TEMP_BED,     s.bed     = LROUND(thermalManager.degBed() * 10));
+  TERN_(HAS_TEMP_CHAMBER, s.chamber = LROUND(thermalManager.degChamber() * 10));
+  if (++head == PROUI_TEMP_HISTORY) head = 0;
+  if (used < PROUI_TEMP_HISTORY) used++;
+  recorded++;
+}
+
+int16_t TempHistory::get(const uint16_t age, const heater_id_t heater) {
+  const temp_sample_t &s = samples[(head + PROUI_TEMP_HISTORY - 1 - age) % PROUI_TEMP_HISTORY];
+  switch (heater) {
+    OPTCODE(HAS_TEMP_BED,     case H_BED:     return s.bed)
+    OPTCODE(HAS_TEMP_CHAMBER, case H_CHAMBER: return s.chamber)
+    default: return TERN(HAS_TEMP_HOTEND, s.hotend, 0);
+  }
+}
+
+void TempHistory::report(const uint16_t last/*=0*/) {
+  const uint16_t n = last ? _MIN(last, used) : used;
+  SERIAL_ECHOLNPGM("Temperature history: ", n, " samples ", TEMP_HISTORY_INTERVAL, "ms apart");
+  SERIAL_ECHOLNPGM("ms" TERN_(HAS_TEMP_HOTEND, ",hotend") TERN_(HAS_TEMP_BED, ",bed") TERN_(HAS_TEMP_CHAMBER, ",chamber"));
+  for (uint16_t age = n; age--;) {
+    hal.watchdog_refresh();
+    SERIAL_ECHO(-int32_t(age) * (TEMP_HISTORY_INTERVAL));
+    #if HAS_TEMP_HOTEND
+      SERIAL_ECHO(F(","), p_float_t(get(age, H_E0) * 0.1f, 1));
+    #endif
+    #if HAS_TEMP_BED
+      SERIAL_ECHO(F(","), p_float_t(get(age, H_BED) * 0.1f, 1));
+    #endif
+    #if HAS_TEMP_CHAMBER
+      SERIAL_ECHO(F(","), p_float_t(get(age, H_CHAMBER) * 0.1f, 1));
+    #endif
+    SERIAL_EOL();
+  }
+}
+
+#endif // DWIN_LCD_PROUI && PROUI_TEMP_HISTORY
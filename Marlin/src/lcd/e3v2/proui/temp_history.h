@@ -0,0 +1,64 @@
+/**
+ * Temperature history for the DWIN plot
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as
+ * published by the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+#pragma once
+
+#include "../../../inc/MarlinConfigPre.h"
+#include "../../../module/temperature.h"
+
+#define TEMP_HISTORY_INTERVAL 500 // (ms) Time between samples
+
+// One sample, in tenths of a degree
+typedef struct {
+  #if HAS_TEMP_HOTEND
+    int16_t hotend;     // The active extruder, as plotted
+  #endif
+  #if HAS_TEMP_BED
+    int16_t bed;
+  #endif
+  #if HAS_TEMP_CHAMBER
+    int16_t chamber;
+  #endif
+} temp_sample_t;
+
+/**
+ * Ring buffer of the last PROUI_TEMP_HISTORY temperature samples.
+ * Filled from Temperature::updateTemperaturesFromRawValues() whether
+ * or not a plot is on screen, so the plot can show what came before.
+ */
+class TempHistory {
+public:
+  static void record();
+
+  // Samples held, and samples recorded since boot
+  static uint16_t count() { return used; }
+  static uint32_t total() { return recorded; }
+
+  // Temperature of a heater (H_E0, H_BED, H_CHAMBER) in tenths of a degree. Age 0 is the newest sample.
+  static int16_t get(const uint16_t age, const heater_id_t heater);
+
+  // Print the newest 'last' samples (0 for all) as CSV
+  static void report(const uint16_t last=0);
+
+private:
+  static temp_sample_t samples[PROUI_TEMP_HISTORY];
+  static uint16_t head, used;
+  static uint32_t recorded;
+  static millis_t next_ms;
+};
+
+extern TempHistory tempHistory;
@@ -64,7 +64,7 @@ void Draw_ToolBar(bool force /*=false*/) {
 void UpdateTBSetupItem(MenuItemClass* menuitem, uint8_t val) {
   TBGetItem(val);
   menuitem->icon = TBItem->icon ?: ICON_Info;
-  strcpy_P(menuitem->caption, FTOP(TBItem->caption));
+  menuitem->SetCaption(FTOP(TBItem->caption));
 }
 
 void DrawTBSetupItem(bool focused) {
@@ -461,6 +461,8 @@ void menu_move() {
         }
       #endif
 
+      EDIT_ITEM(bool, MSG_FTM_S_CURVE, &c.sCurveEna);
+
       #if HAS_EXTRUDERS
         EDIT_ITEM(bool, MSG_LINEAR_ADVANCE, &c.linearAdvEna);
         if (c.linearAdvEna || ENABLED(FT_MOTION_NO_MENU_TOGGLE))
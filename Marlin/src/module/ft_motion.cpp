@@ -86,18 +86,18 @@ uint32_t FTMotion::makeVector_idx = 0,          // Index of fixed time trajector
 
 // Interpolation variables.
 xyze_long_t FTMotion::steps = { 0 };            // Step count accumulator.
+xyze_float_t FTMotion::steps_per_mm = { 0 };    // Steps per mm for the block being loaded.
 
 uint32_t FTMotion::interpIdx = 0;               // Index of current data point being interpolated.
 
 // Shaping variables.
 #if HAS_FTM_SHAPING
   FTMotion::shaping_t FTMotion::shaping = {
-    0
     #if HAS_X_AXIS
-      , x:{ false, { 0.0f }, { 0.0f }, { 0 }, 0 } // ena, d_zi[], Ai[], Ni[], max_i
+      x:{ false, { 0.0f }, { 0.0f }, { 0 }, 0, 0.0f } // ena, d_zi[], Ai[], Ni[], max_i, freq
     #endif
     #if HAS_Y_AXIS
-      , y:{ false, { 0.0f }, { 0.0f }, { 0 }, 0 } // ena, d_zi[], Ai[], Ni[], max_i
+      , y:{ false, { 0.0f }, { 0.0f }, { 0 }, 0, 0.0f } // ena, d_zi[], Ai[], Ni[], max_i, freq
     #endif
   };
 #endif
@@ -177,6 +177,9 @@ void FTMotion::loop() {
   // FBS / post processing.
   if (batchRdy && !batchRdyForInterp) {
 
+    // Apply input shaping to the whole batch.
+    TERN_(HAS_FTM_SHAPING, shapeBatch());
+
     // Call Ulendo FBS here.
 
     #if ENABLED(FTM_UNIFIED_BWS)
@@ -317,6 +320,7 @@ void FTMotion::loop() {
   // Refresh the indices used by shaping functions.
   void FTMotion::AxisShaping::set_axis_shaping_N(const ftMotionShaper_t shaper, const_float_t f, const_float_t zeta) {
     // Note that protections are omitted for DBZ and for index exceeding array length.
+    freq = f;
     const float df = sqrt ( 1.f - sq(zeta) );
     switch (shaper) {
       case ftMotionShaper_ZV:
@@ -348,6 +352,92 @@ void FTMotion::loop() {
     }
   }
 
+  // Append a batch of unshaped points to the delay line.
+  void FTMotion::AxisShaping::load(const float * const in) {
+    memcpy(&d_zi[FTM_ZMAX], in, (FTM_BATCH_SIZE) * sizeof(d_zi[0]));
+  }
+
+  // Shape a run of points of the loaded batch with the current gains and indices.
+  // Each shaping term is a contiguous multiply-accumulate over the run.
+  void FTMotion::AxisShaping::shape(float * const out, const uint32_t from, const uint32_t to) {
+    const float * const in = &d_zi[FTM_ZMAX];
+    const float a0 = Ai[0];
+    for (uint32_t n = from; n < to; n++) out[n] = a0 * in[n];
+    for (uint32_t i = 1U; i <= max_i; i++) {
+      const float a = Ai[i], * const d = in - Ni[i];
+      for (uint32_t n = from; n < to; n++) out[n] += a * d[n];
+    }
+  }
+
+  // Move the last FTM_ZMAX points to the start of the delay line.
+  void FTMotion::AxisShaping::shift() {
+    memmove(d_zi, &d_zi[FTM_BATCH_SIZE], (FTM_ZMAX) * sizeof(d_zi[0]));
+  }
+
+  /**
+   * Shape the new batch in the trajectory window.
+   * With a dynamic frequency the batch is shaped in runs, and the indices are only
+   * recomputed when the frequency has moved more than FTM_DYNFREQ_TOLERANCE.
+   */
+  void FTMotion::shapeBatch() {
+    #if HAS_X_AXIS
+      float * const bx = &traj.x[BATCH_SIDX_IN_WINDOW];
+      uint32_t x_from = 0;
+      if (shaping.x.ena) shaping.x.load(bx);
+    #endif
+    #if HAS_Y_AXIS
+      float * const by = &traj.y[BATCH_SIDX_IN_WINDOW];
+      uint32_t y_from = 0;
+      if (shaping.y.ena) shaping.y.load(by);
+    #endif
+
+    #if HAS_DYNAMIC_FREQ
+      if (cfg.dynFreqMode != dynFreqMode_DISABLED) {
+        const float * const src = (
+          #if ALL(HAS_DYNAMIC_FREQ_MM, HAS_DYNAMIC_FREQ_G)
+            cfg.dynFreqMode == dynFreqMode_Z_BASED ? traj.z : traj.e
+          #elif HAS_DYNAMIC_FREQ_MM
+            traj.z
+          #else
+            traj.e
+          #endif
+        ) + BATCH_SIDX_IN_WINDOW;
+
+        #define _DYN_FREQ(A) do{ \
+          const float f = _MAX(cfg.baseFreq.A + cfg.dynFreqK.A * v, FTM_MIN_SHAPE_FREQ); \
+          if (ABS(f - shaping.A.freq) > (FTM_DYNFREQ_TOLERANCE)) { \
+            shaping.A.shape(b##A, A##_from, n); \
+            A##_from = n; \
+            shaping.A.set_axis_shaping_N(cfg.shaper.A, f, cfg.zeta.A); \
+          } \
+        }while(0)
+
+        for (uint32_t n = 0; n < (FTM_BATCH_SIZE); n++) {
+          const float v = src[n];
+          #if HAS_X_AXIS
+            if (shaping.x.ena) _DYN_FREQ(x);
+          #endif
+          #if HAS_Y_AXIS
+            if (shaping.y.ena) _DYN_FREQ(y);
+          #endif
+        }
+      }
+    #endif
+
+    #if HAS_X_AXIS
+      if (shaping.x.ena) {
+        shaping.x.shape(bx, x_from, FTM_BATCH_SIZE);
+        shaping.x.shift();
+      }
+    #endif
+    #if HAS_Y_AXIS
+      if (shaping.y.ena) {
+        shaping.y.shape(by, y_from, FTM_BATCH_SIZE);
+        shaping.y.shift();
+      }
+    #endif
+  }
+
   void FTMotion::update_shaping_params() {
     #if HAS_X_AXIS
       if ((shaping.x.ena = AXIS_HAS_SHAPER(X))) {
@@ -387,7 +477,6 @@ void FTMotion::reset() {
   #if HAS_FTM_SHAPING
     TERN_(HAS_X_AXIS, ZERO(shaping.x.d_zi));
     TERN_(HAS_Y_AXIS, ZERO(shaping.y.d_zi));
-    shaping.zi_idx = 0;
   #endif
 
   TERN_(HAS_EXTRUDERS, e_raw_z1 = e_advanced_z1 = 0.0f);
@@ -459,6 +548,14 @@ void FTMotion::loadBlockData(block_t * const current_block) {
   const float totalLength = current_block->millimeters,
               oneOverLength = 1.0f / totalLength;
 
+  // Look up steps per mm once per block instead of once per trajectory point
+  steps_per_mm = LOGICAL_AXIS_ARRAY(
+    planner.settings.axis_steps_per_mm[E_AXIS_N(current_block->extruder)],
+    planner.settings.axis_steps_per_mm[X_AXIS], planner.settings.axis_steps_per_mm[Y_AXIS], planner.settings.axis_steps_per_mm[Z_AXIS],
+    planner.settings.axis_steps_per_mm[I_AXIS], planner.settings.axis_steps_per_mm[J_AXIS], planner.settings.axis_steps_per_mm[K_AXIS],
+    planner.settings.axis_steps_per_mm[U_AXIS], planner.settings.axis_steps_per_mm[V_AXIS], planner.settings.axis_steps_per_mm[W_AXIS]
+  );
+
   startPosn = endPosn_prevBlock;
   const xyze_pos_t moveDist = LOGICAL_AXIS_ARRAY(
     current_block->steps.e * planner.mm_per_step[E_AXIS_N(current_block->extruder)] * (current_block->direction_bits.e ? 1 : -1),
@@ -578,6 +675,18 @@ void FTMotion::loadBlockData(block_t * const current_block) {
 
 }
 
+/**
+ * S-curve profile for a change of speed over a fixed time.
+ * The speed follows the 6-point Bezier curve used by S_CURVE_ACCELERATION:
+ *   v(u) = v0 + (v1 - v0) * (10u^3 - 15u^4 + 6u^5),  u = t / T
+ * so acceleration and jerk are zero at both ends. The phase takes the same time
+ * and distance as the trapezoid it replaces, with a peak acceleration 15/8 of it.
+ */
+// Distance covered as a fraction of (v1 - v0) * T. Reaches 1/2 at u = 1, like the trapezoid.
+FORCE_INLINE static float scurve_dist(const float u) { return sq(sq(u)) * (2.5f + u * (u - 3.0f)); }
+// Acceleration as a fraction of the trapezoid's constant acceleration.
+FORCE_INLINE static float scurve_accel(const float u) { return 30.0f * sq(u * (1.0f - u)); }
+
 // Generate data points of the trajectory.
 void FTMotion::makeVector() {
   float accel_k = 0.0f;                                 // (mm/s^2) Acceleration K factor
@@ -586,8 +695,16 @@ void FTMotion::makeVector() {
 
   if (makeVector_idx < N1) {
     // Acceleration phase
-    dist = (f_s * tau) + (0.5f * accel_P * sq(tau));    // (mm) Distance traveled for acceleration phase since start of block
-    accel_k = accel_P;                                  // (mm/s^2) Acceleration K factor from Accel phase
+    if (cfg.sCurveEna) {
+      const float T1_P = N1 * (FTM_TS),                 // (s) Accel phase duration
+                  u = tau / T1_P;                       // Fraction of the accel phase
+      dist = (f_s * tau) + accel_P * sq(T1_P) * scurve_dist(u);
+      accel_k = accel_P * scurve_accel(u);
+    }
+    else {
+      dist = (f_s * tau) + (0.5f * accel_P * sq(tau));  // (mm) Distance traveled for acceleration phase since start of block
+      accel_k = accel_P;                                // (mm/s^2) Acceleration K factor from Accel phase
+    }
   }
   else if (makeVector_idx < (N1 + N2)) {
     // Coasting phase
@@ -597,8 +714,16 @@ void FTMotion::makeVector() {
   else {
     // Deceleration phase
     tau -= (N1 + N2) * (FTM_TS);                        // (s) Time since start of decel phase
-    dist = s_2e + F_P * tau + 0.5f * decel_P * sq(tau); // (mm) Distance traveled for deceleration phase since start of block
-    accel_k = decel_P;                                  // (mm/s^2) Acceleration K factor from Decel phase
+    if (cfg.sCurveEna) {
+      const float T3_P = N3 * (FTM_TS),                 // (s) Decel phase duration
+                  u = tau / T3_P;                       // Fraction of the decel phase
+      dist = s_2e + F_P * tau + decel_P * sq(T3_P) * scurve_dist(u);
+      accel_k = decel_P * scurve_accel(u);
+    }
+    else {
+      dist = s_2e + F_P * tau + 0.5f * decel_P * sq(tau); // (mm) Distance traveled for deceleration phase since start of block
+      accel_k = decel_P;                                // (mm/s^2) Acceleration K factor from Decel phase
+    }
   }
 
   #define _SET_TRAJ(q) traj.q[makeVector_batchIdx] = startPosn.q + ratio.q * dist;
@@ -615,70 +740,6 @@ void FTMotion::makeVector() {
     }
   #endif
 
-  // Update shaping parameters if needed.
-
-  switch (cfg.dynFreqMode) {
-
-    #if HAS_DYNAMIC_FREQ_MM
-      case dynFreqMode_Z_BASED: {
-        static float oldz = 0.0f;
-        const float z = traj.z[makeVector_batchIdx];
-        if (z != oldz) { // Only update if Z changed.
-          oldz = z;
-          #if HAS_X_AXIS
-            const float xf = cfg.baseFreq.x + cfg.dynFreqK.x * z;
-            shaping.x.set_axis_shaping_N(cfg.shaper.x, _MAX(xf, FTM_MIN_SHAPE_FREQ), cfg.zeta.x);
-          #endif
-          #if HAS_Y_AXIS
-            const float yf = cfg.baseFreq.y + cfg.dynFreqK.y * z;
-            shaping.y.set_axis_shaping_N(cfg.shaper.y, _MAX(yf, FTM_MIN_SHAPE_FREQ), cfg.zeta.y);
-          #endif
-        }
-      } break;
-    #endif
-
-    #if HAS_DYNAMIC_FREQ_G
-      case dynFreqMode_MASS_BASED:
-        // Update constantly. The optimization done for Z value makes
-        // less sense for E, as E is expected to constantly change.
-        #if HAS_X_AXIS
-          shaping.x.set_axis_shaping_N(cfg.shaper.x, cfg.baseFreq.x + cfg.dynFreqK.x * traj.e[makeVector_batchIdx], cfg.zeta.x);
-        #endif
-        #if HAS_Y_AXIS
-          shaping.y.set_axis_shaping_N(cfg.shaper.y, cfg.baseFreq.y + cfg.dynFreqK.y * traj.e[makeVector_batchIdx], cfg.zeta.y);
-        #endif
-        break;
-    #endif
-
-    default: break;
-  }
-
-  // Apply shaping if active on each axis
-  #if HAS_FTM_SHAPING
-    #if HAS_X_AXIS
-      if (shaping.x.ena) {
-        shaping.x.d_zi[shaping.zi_idx] = traj.x[makeVector_batchIdx];
-        traj.x[makeVector_batchIdx] *= shaping.x.Ai[0];
-        for (uint32_t i = 1U; i <= shaping.x.max_i; i++) {
-          const uint32_t udiffx = shaping.zi_idx - shaping.x.Ni[i];
-          traj.x[makeVector_batchIdx] += shaping.x.Ai[i] * shaping.x.d_zi[shaping.x.Ni[i] > shaping.zi_idx ? (FTM_ZMAX) + udiffx : udiffx];
-        }
-      }
-    #endif
-
-    #if HAS_Y_AXIS
-      if (shaping.y.ena) {
-        shaping.y.d_zi[shaping.zi_idx] = traj.y[makeVector_batchIdx];
-        traj.y[makeVector_batchIdx] *= shaping.y.Ai[0];
-        for (uint32_t i = 1U; i <= shaping.y.max_i; i++) {
-          const uint32_t udiffy = shaping.zi_idx - shaping.y.Ni[i];
-          traj.y[makeVector_batchIdx] += shaping.y.Ai[i] * shaping.y.d_zi[shaping.y.Ni[i] > shaping.zi_idx ? (FTM_ZMAX) + udiffy : udiffy];
-        }
-      }
-    #endif
-    if (++shaping.zi_idx == (FTM_ZMAX)) shaping.zi_idx = 0;
-  #endif // HAS_FTM_SHAPING
-
   // Filled up the queue with regular and shaped steps
   if (++makeVector_batchIdx == FTM_WINDOW_SIZE) {
     makeVector_batchIdx = BATCH_SIDX_IN_WINDOW;
@@ -694,71 +755,64 @@ void FTMotion::makeVector() {
 /**
  * Convert to steps
  * - Commands are written in a bitmask with step and dir as single bits.
- * - Tests for delta are moved outside the loop.
- * - Two functions are used for command computation with an array of function pointers.
+ * - Each axis is a DDA on the magnitude of its step delta, so the inner loop
+ *   is integer-only with no per-axis branches or function pointers.
+ * - The axis set is fixed at compile time. Each axis is one inlined call with
+ *   its step bit as a template argument.
+ * - The direction bits are set once for the interval. The stepper only reads
+ *   the DIR bit of an axis in a command that also steps that axis.
  */
-static void (*command_set[LOGICAL_AXES])(int32_t&, int32_t&, ft_command_t&, int32_t, int32_t);
-
-static void command_set_pos(int32_t &e, int32_t &s, ft_command_t &b, int32_t bd, int32_t bs) {
-  if (e < FTM_CTS_COMPARE_VAL) return;
-  s++;
-  b |= bd | bs;
-  e -= FTM_STEPS_PER_UNIT_TIME;
-}
-
-static void command_set_neg(int32_t &e, int32_t &s, ft_command_t &b, int32_t bd, int32_t bs) {
-  if (e > -(FTM_CTS_COMPARE_VAL)) return;
-  s--;
-  b |= bs;
-  e += FTM_STEPS_PER_UNIT_TIME;
+template<uint8_t STEP_BIT>
+FORCE_INLINE static ft_command_t ftm_axis_step(int32_t &err, const int32_t inc) {
+  err += inc;
+  const int32_t stp = err >= (FTM_CTS_COMPARE_VAL);
+  err -= stp * (FTM_STEPS_PER_UNIT_TIME);
+  return ft_command_t(stp) << STEP_BIT;
 }
 
 // Interpolates single data point to stepper commands.
 void FTMotion::convertToSteps(const uint32_t idx) {
-  xyze_long_t err_P = { 0 };
 
   //#define STEPS_ROUNDING
   #if ENABLED(STEPS_ROUNDING)
-    #define TOSTEPS(A,B) int32_t(trajMod.A[idx] * planner.settings.axis_steps_per_mm[B] + (trajMod.A[idx] < 0.0f ? -0.5f : 0.5f))
-    const xyze_long_t steps_tar = LOGICAL_AXIS_ARRAY(
-      TOSTEPS(e, E_AXIS_N(stepper.current_block->extruder)), // May be eliminated if guaranteed positive.
-      TOSTEPS(x, X_AXIS), TOSTEPS(y, Y_AXIS), TOSTEPS(z, Z_AXIS),
-      TOSTEPS(i, I_AXIS), TOSTEPS(j, J_AXIS), TOSTEPS(k, K_AXIS),
-      TOSTEPS(u, U_AXIS), TOSTEPS(v, V_AXIS), TOSTEPS(w, W_AXIS)
-    );
-    xyze_long_t delta = steps_tar - steps;
+    #define TOSTEPS(A) int32_t(trajMod.A[idx] * steps_per_mm.A + (trajMod.A[idx] < 0.0f ? -0.5f : 0.5f)) - steps.A
   #else
-    #define TOSTEPS(A,B) int32_t(trajMod.A[idx] * planner.settings.axis_steps_per_mm[B]) - steps.A
-    xyze_long_t delta = LOGICAL_AXIS_ARRAY(
-      TOSTEPS(e, E_AXIS_N(stepper.current_block->extruder)),
-      TOSTEPS(x, X_AXIS), TOSTEPS(y, Y_AXIS), TOSTEPS(z, Z_AXIS),
-      TOSTEPS(i, I_AXIS), TOSTEPS(j, J_AXIS), TOSTEPS(k, K_AXIS),
-      TOSTEPS(u, U_AXIS), TOSTEPS(v, V_AXIS), TOSTEPS(w, W_AXIS)
-    );
+    #define TOSTEPS(A) int32_t(trajMod.A[idx] * steps_per_mm.A) - steps.A
   #endif
 
-  #define _COMMAND_SET(AXIS) command_set[_AXIS(AXIS)] = delta[_AXIS(AXIS)] >= 0 ? command_set_pos : command_set_neg;
-  LOGICAL_AXIS_MAP(_COMMAND_SET);
+  // Steps to take along each axis in this interval, as a magnitude and direction
+  xyze_long_t inc, err = { 0 };
+  ft_command_t dir_bits = 0;
+  #define _DELTA_SETUP(A) { \
+    const int32_t d = TOSTEPS(A); \
+    dir_bits |= ft_command_t(d >= 0) << FT_BIT_DIR_##A; \
+    inc.A = d >= 0 ? d : -d; \
+  }
+  LOGICAL_AXIS_MAP(_DELTA_SETUP);
 
   for (uint32_t i = 0U; i < (FTM_STEPS_PER_UNIT_TIME); i++) {
 
-    ft_command_t &cmd = stepperCmdBuff[stepperCmdBuff_produceIdx];
-
-    // Init all step/dir bits to 0 (defaulting to reverse/negative motion)
-    cmd = 0;
+    ft_command_t cmd = dir_bits;
 
-    // Accumulate the errors for all axes
-    err_P += delta;
-
-    // Set up step/dir bits for all axes
-    #define _COMMAND_RUN(A) command_set[_AXIS(A)](err_P.A, steps.A, cmd, _BV(FT_BIT_DIR_##A), _BV(FT_BIT_STEP_##A));
+    // Accumulate the errors for all axes and set their step bits
+    #define _COMMAND_RUN(A) cmd |= ftm_axis_step<FT_BIT_STEP_##A>(err.A, inc.A);
     LOGICAL_AXIS_MAP(_COMMAND_RUN);
 
+    stepperCmdBuff[stepperCmdBuff_produceIdx] = cmd;
+
     // Next circular buffer index
     if (++stepperCmdBuff_produceIdx == (FTM_STEPPERCMD_BUFF_SIZE))
       stepperCmdBuff_produceIdx = 0;
 
   } // FTM_STEPS_PER_UNIT_TIME loop
+
+  // Count the steps taken. Each step took FTM_STEPS_PER_UNIT_TIME off the
+  // accumulated increments, so the remaining error is an exact multiple of it.
+  #define _COUNT_STEPS(A) { \
+    const int32_t n = inc.A - err.A / (FTM_STEPS_PER_UNIT_TIME); \
+    steps.A += TEST(dir_bits, FT_BIT_DIR_##A) ? n : -n; \
+  }
+  LOGICAL_AXIS_MAP(_COUNT_STEPS);
 }
 
 #endif // FT_MOTION
@@ -58,6 +58,8 @@ typedef struct FTConfig {
     #endif
   #endif // HAS_FTM_SHAPING
 
+  bool sCurveEna = ENABLED(S_CURVE_ACCELERATION);         // Jerk-limited (S-curve) acceleration, else trapezoidal
+
   #if HAS_EXTRUDERS
     bool linearAdvEna = FTM_LINEAR_ADV_DEFAULT_ENA;       // Linear advance enable configuration.
     float linearAdvK = FTM_LINEAR_ADV_DEFAULT_K;          // Linear advance gain.
@@ -101,6 +103,8 @@ class FTMotion {
 
       #endif // HAS_FTM_SHAPING
 
+      cfg.sCurveEna = ENABLED(S_CURVE_ACCELERATION);
+
       #if HAS_EXTRUDERS
         cfg.linearAdvEna = FTM_LINEAR_ADV_DEFAULT_ENA;
         cfg.linearAdvK = FTM_LINEAR_ADV_DEFAULT_K;
@@ -168,24 +172,29 @@ class FTMotion {
     static uint32_t interpIdx;
 
     static xyze_long_t steps;
+    static xyze_float_t steps_per_mm;
 
     // Shaping variables.
     #if HAS_FTM_SHAPING
 
       typedef struct AxisShaping {
         bool ena = false;                 // Enabled indication.
-        float d_zi[FTM_ZMAX] = { 0.0f };  // Data point delay vector.
+        float d_zi[(FTM_ZMAX) + (FTM_BATCH_SIZE)] = { 0.0f }; // Data point delay line. FTM_ZMAX past points followed by the batch.
         float Ai[5];                      // Shaping gain vector.
         uint32_t Ni[5];                   // Shaping time index vector.
         uint32_t max_i;                   // Vector length for the selected shaper.
+        float freq;                       // Frequency the indices were computed for. [Hz]
 
         void set_axis_shaping_N(const ftMotionShaper_t shaper, const_float_t f, const_float_t zeta);    // Sets the gains used by shaping functions.
         void set_axis_shaping_A(const ftMotionShaper_t shaper, const_float_t zeta, const_float_t vtol); // Sets the indices used by shaping functions.
 
+        void load(const float * const in);                                  // Append a batch to the delay line.
+        void shape(float * const out, const uint32_t from, const uint32_t to); // Shape batch points [from, to) into out.
+        void shift();                                                       // Keep the last FTM_ZMAX points for the next batch.
+
       } axis_shaping_t;
 
       typedef struct Shaping {
-        uint32_t zi_idx;           // Index of storage in the data point delay vectors.
         #if HAS_X_AXIS
           axis_shaping_t x;
         #endif
@@ -209,6 +218,9 @@ class FTMotion {
     static int32_t stepperCmdBuffItems();
     static void loadBlockData(block_t *const current_block);
     static void makeVector();
+    #if HAS_FTM_SHAPING
+      static void shapeBatch();
+    #endif
     static void convertToSteps(const uint32_t idx);
 
     FORCE_INLINE static int32_t num_samples_shaper_settle() { return ( shaping.x.ena || shaping.y.ena ) ? FTM_ZMAX : 0; }
@@ -113,6 +113,14 @@
   #include "../feature/spindle_laser.h"
 #endif
 
+#if ENABLED(REPLAY_BENCH)
+  #include "../tests/replay_bench.h"
+#endif
+
+#if ENABLED(PLANNER_HEALTH)
+  #include "../feature/planner_health.h"
+#endif
+
 // Delay for delivery of first block to the stepper ISR, if the queue contains 2 or
 // fewer movements. The delay is measured in milliseconds, and must be less than 250ms
 #define BLOCK_DELAY_NONE         0U
@@ -132,6 +140,7 @@ block_t Planner::block_buffer[BLOCK_BUFFER_SIZE];
 volatile uint8_t Planner::block_buffer_head,    // Index of the next block to be pushed
                  Planner::block_buffer_nonbusy, // Index of the first non-busy block
                  Planner::block_buffer_tail;    // Index of the busy block, if any
+uint8_t Planner::block_buffer_planned;          // Index of the last block whose entry speed can no longer change
 uint16_t Planner::cleaning_buffer_counter;      // A counter to disable queuing of blocks
 uint8_t Planner::delay_before_delivering;       // Delay block delivery so initial blocks in an empty queue may merge
 
@@ -801,6 +810,10 @@ void Planner::calculate_trapezoid_for_block(block_t * const block, const_float_t
   NOLESS(final_rate,          stepper.minimal_step_rate);
   NOLESS(block->nominal_rate, stepper.minimal_step_rate);
 
+  // The profile only depends on the entry and exit rates. Skip the rest if
+  // neither changed since the trapezoid was last calculated.
+  if (initial_rate == block->initial_rate && final_rate == block->final_rate) return;
+
   #if ANY(S_CURVE_ACCELERATION, LIN_ADVANCE)
     // If we have some plateau time, the cruise rate will be the nominal rate
     uint32_t cruise_rate = block->nominal_rate;
@@ -1038,9 +1051,12 @@ void Planner::reverse_pass(const_float_t safe_exit_speed_sqr) {
   // The ISR may change block_buffer_nonbusy so get a stable local copy.
   uint8_t nonbusy_block_index = block_buffer_nonbusy;
 
+  // Blocks up to the planned block are already optimal
+  const uint8_t planned_block_index = block_buffer_planned;
+
   const block_t *next = nullptr;
   // Don't try to change the entry speed of the first non-busy block.
-  while (block_index != nonbusy_block_index) {
+  while (block_index != nonbusy_block_index && block_index != planned_block_index) {
     block_t *current = &block_buffer[block_index];
 
     // Only process movement blocks
@@ -1058,7 +1074,7 @@ void Planner::reverse_pass(const_float_t safe_exit_speed_sqr) {
     while (nonbusy_block_index != block_buffer_nonbusy) {
 
       // If we reached the busy block or an already processed block, break the loop now
-      if (block_index == nonbusy_block_index) return;
+      if (block_index == nonbusy_block_index || block_index == planned_block_index) return;
 
       // Advance the pointer, following the busy block
       nonbusy_block_index = next_block_index(nonbusy_block_index);
@@ -1099,6 +1115,16 @@ void Planner::recalculate_trapezoids(const_float_t safe_exit_speed_sqr) {
 
   block_t *block = nullptr, *next = nullptr;
   float next_entry_speed = 0.0f;
+
+  // Skip the blocks before the planned block. Their trapezoids are final and
+  // the planned block's entry speed won't change, so start from its exit.
+  // A zero entry speed tells calculate_trapezoid_for_block to keep its initial_rate.
+  const uint8_t planned_block_index = block_buffer_planned;
+  if (planned_block_index != block_index && block_dec_mod(planned_block_index, block_index) < block_dec_mod(head_block_index, block_index)) {
+    block = &block_buffer[planned_block_index];
+    block_index = next_block_index(planned_block_index);
+  }
+
   while (block_index != head_block_index) {
 
     next = &block_buffer[block_index];
@@ -1128,6 +1154,9 @@ void Planner::recalculate_trapezoids(const_float_t safe_exit_speed_sqr) {
               next->initial_rate = block->final_rate;
             }
             // Note that at this point next_entry_speed is (still) 0.
+
+            // With the busy block's exit speed fixed, so is next's entry speed
+            block_buffer_planned = block_index;
           }
           else {
             // Block is not BUSY: we won the race against the ISR or recalculate was already set
@@ -1139,6 +1168,10 @@ void Planner::recalculate_trapezoids(const_float_t safe_exit_speed_sqr) {
             next_entry_speed = SQRT(next->entry_speed_sqr);
 
             calculate_trapezoid_for_block(block, current_entry_speed, next_entry_speed);
+
+            // Already at its max entry speed, or limited by acceleration from a planned block?
+            // Then the entry speed can't change and all blocks before it are optimal.
+            if (next->entry_speed_sqr == next->max_entry_speed_sqr) block_buffer_planned = block_index;
           }
 
           // Reset current only to ensure next trapezoid is computed - The
@@ -1583,7 +1616,7 @@ void Planner::quick_stop() {
   const bool was_enabled = stepper.suspend();
 
   // Drop all queue entries
-  block_buffer_nonbusy = block_buffer_head = block_buffer_tail;
+  block_buffer_planned = block_buffer_nonbusy = block_buffer_head = block_buffer_tail;
 
   // Restart the block delay for the first movement - As the queue was
   // forced to empty, there's no risk the ISR will touch this.
@@ -1723,6 +1756,8 @@ bool Planner::_buffer_steps(const xyze_long_t &target
   uint8_t next_buffer_head;
   block_t * const block = get_next_free_block(next_buffer_head);
 
+  TERN_(REPLAY_BENCH, const uint64_t bench_start_ns = ReplayBench::nanos());
+
   // If we are cleaning, do not accept queuing of movements
   // This must be after get_next_free_block() because it calls idle()
   // where cleaning_buffer_counter can be changed
@@ -1752,6 +1787,8 @@ bool Planner::_buffer_steps(const xyze_long_t &target
     delay_before_delivering = TERN_(FT_MOTION, ftMotion.cfg.active ? BLOCK_DELAY_NONE :) BLOCK_DELAY_FOR_1ST_MOVE;
   }
 
+  TERN_(PLANNER_HEALTH, plannerHealth.block_added(movesplanned()));
+
   // Move buffer head
   block_buffer_head = next_buffer_head;
 
@@ -1762,7 +1799,11 @@ bool Planner::_buffer_steps(const xyze_long_t &target
   );
 
   // Recalculate and optimize trapezoidal speed profiles
+  TERN_(REPLAY_BENCH, const uint64_t bench_recalc_ns = ReplayBench::nanos());
+  TERN_(PLANNER_HEALTH, const uint32_t health_recalc_us = micros());
   recalculate(safe_exit_speed_sqr);
+  TERN_(PLANNER_HEALTH, plannerHealth.recalculated(micros() - health_recalc_us));
+  TERN_(REPLAY_BENCH, ReplayBench::planned(block - block_buffer, bench_start_ns, bench_recalc_ns));
 
   // Movement successfully queued!
   return true;
@@ -2460,6 +2501,20 @@ bool Planner::_populate_block(
     }
   #endif
 
+  #if ENABLED(NONLINEAR_EXTRUSION)
+    // Convert to fixed point here so the Stepper ISR only needs integer multiplies
+    block->ne_scale = (1L << 24) * (float(block->steps.e) / block->step_event_count) * mm_per_step[E_AXIS_N(extruder)];
+    if (block->direction_bits.e && ANY_AXIS_MOVES(block)) {
+      block->ne.A = (1L << 24) * stepper.ne.A;
+      block->ne.B = (1L << 24) * stepper.ne.B;
+      block->ne.C = (1L << 24) * stepper.ne.C;
+    }
+    else {
+      block->ne.A = block->ne.B = 0;
+      block->ne.C = (1L << 24);
+    }
+  #endif
+
   // Formula for the average speed over a 1 step worth of distance if starting from zero and
   // accelerating at the current limit. Since we can only change the speed every step this is a
   // good lower limit for the entry and exit speeds. Note that for calculate_trapezoid_for_block()
@@ -2532,37 +2587,44 @@ bool Planner::_populate_block(
 
     // Skip first block or when previous_nominal_speed is used as a flag for homing and offset cycles.
     if (moves_queued && !UNEAR_ZERO(previous_nominal_speed)) {
-      // Compute cosine of angle between previous and current path. (prev_unit_vec is negative)
-      /// NOTE: Max junction velocity is computed without sin() or acos() by trig half angle identity.
-      float junction_cos_theta = LOGICAL_AXIS_GANG(
-                                 + (-prev_unit_vec.e * unit_vec.e),
-                                 + (-prev_unit_vec.x * unit_vec.x),
-                                 + (-prev_unit_vec.y * unit_vec.y),
-                                 + (-prev_unit_vec.z * unit_vec.z),
-                                 + (-prev_unit_vec.i * unit_vec.i),
-                                 + (-prev_unit_vec.j * unit_vec.j),
-                                 + (-prev_unit_vec.k * unit_vec.k),
-                                 + (-prev_unit_vec.u * unit_vec.u),
-                                 + (-prev_unit_vec.v * unit_vec.v),
-                                 + (-prev_unit_vec.w * unit_vec.w)
-                               );
-
-      /// NOTE: Computed without any expensive trig, sin() or acos(), by trig half angle identity of cos(theta).
-      if (junction_cos_theta > 0.999999f) {
-        // For a 0 degree acute junction, just set minimum junction speed.
-        vmax_junction_sqr = minimum_planner_speed_sqr;
-      }
-      else {
-        // Convert delta vector to unit vector
-        xyze_float_t junction_unit_vec = unit_vec - prev_unit_vec;
-        normalize_junction_vector(junction_unit_vec);
-
-        const float junction_acceleration = limit_value_by_axis_maximum(block->acceleration, junction_unit_vec);
-
-        if (TERN0(HINTS_CURVE_RADIUS, hints.curve_radius)) {
-          TERN_(HINTS_CURVE_RADIUS, vmax_junction_sqr = junction_acceleration * hints.curve_radius);
+      #if ENABLED(HINTS_CURVE_RADIUS)
+        if (hints.curve_radius) {
+          // The path is a curve of known radius, so the junction angle isn't needed.
+          // Only the direction of the change in velocity is needed to apply axis limits.
+          xyze_float_t junction_unit_vec = unit_vec - prev_unit_vec;
+          normalize_junction_vector(junction_unit_vec);
+          vmax_junction_sqr = limit_value_by_axis_maximum(block->acceleration, junction_unit_vec) * hints.curve_radius;
+        }
+        else
+      #endif
+      {
+        // Compute cosine of angle between previous and current path. (prev_unit_vec is negative)
+        /// NOTE: Max junction velocity is computed without sin() or acos() by trig half angle identity.
+        float junction_cos_theta = LOGICAL_AXIS_GANG(
+                                   + (-prev_unit_vec.e * unit_vec.e),
+                                   + (-prev_unit_vec.x * unit_vec.x),
+                                   + (-prev_unit_vec.y * unit_vec.y),
+                                   + (-prev_unit_vec.z * unit_vec.z),
+                                   + (-prev_unit_vec.i * unit_vec.i),
+                                   + (-prev_unit_vec.j * unit_vec.j),
+                                   + (-prev_unit_vec.k * unit_vec.k),
+                                   + (-prev_unit_vec.u * unit_vec.u),
+                                   + (-prev_unit_vec.v * unit_vec.v),
+                                   + (-prev_unit_vec.w * unit_vec.w)
+                                 );
+
+        /// NOTE: Computed without any expensive trig, sin() or acos(), by trig half angle identity of cos(theta).
+        if (junction_cos_theta > 0.999999f) {
+          // For a 0 degree acute junction, just set minimum junction speed.
+          vmax_junction_sqr = minimum_planner_speed_sqr;
         }
         else {
+          // Convert delta vector to unit vector
+          xyze_float_t junction_unit_vec = unit_vec - prev_unit_vec;
+          normalize_junction_vector(junction_unit_vec);
+
+          const float junction_acceleration = limit_value_by_axis_maximum(block->acceleration, junction_unit_vec);
+
           NOLESS(junction_cos_theta, -0.999999f); // Check for numerical round-off to avoid divide by zero.
 
           const float sin_theta_d2 = SQRT(0.5f * (1.0f - junction_cos_theta)); // Trig half angle identity. Always positive.
@@ -2657,7 +2719,7 @@ bool Planner::_populate_block(
 
           #endif // JD_HANDLE_SMALL_SEGMENTS
         }
-      }
+      } // !hints.curve_radius
 
       // Get the lowest speed
       vmax_junction_sqr = _MIN(vmax_junction_sqr, sq(block->nominal_speed), sq(previous_nominal_speed));
@@ -2746,8 +2808,8 @@ bool Planner::_populate_block(
   block->entry_speed_sqr = minimum_planner_speed_sqr;
   // Set min entry speed. Rarely it could be higher than the previous nominal speed but that's ok.
   block->min_entry_speed_sqr = minimum_planner_speed_sqr;
-  // Zero the initial_rate to indicate that calculate_trapezoid_for_block() hasn't been called yet.
-  block->initial_rate = 0;
+  // Zero the rates to indicate that calculate_trapezoid_for_block() hasn't been called yet.
+  block->initial_rate = block->final_rate = 0;
 
   block->flag.recalculate = true;
 
@@ -3086,6 +3148,11 @@ bool Planner::buffer_line(const xyze_pos_t &cart, const_feedRate_t fr_mm_s,
     block->accelerate_before = 0;
     block->decelerate_start = block->step_event_count;
 
+    #if ENABLED(NONLINEAR_EXTRUSION)
+      block->ne_scale = block->ne.A = block->ne.B = 0;
+      block->ne.C = (1L << 24);
+    #endif
+
     // Will be set to last direction later if directional format.
     block->direction_bits.reset();
 
@@ -191,6 +191,11 @@ typedef struct {
 
 #endif
 
+#if ENABLED(NONLINEAR_EXTRUSION)
+  typedef struct { float A, B, C; void reset() { A = B = 0.0f; C = 1.0f; } } ne_coeff_t;
+  typedef struct { int32_t A, B, C; } ne_fix_t;
+#endif
+
 /**
  * struct block_t
  *
@@ -260,6 +265,11 @@ typedef struct PlannerBlock {
              final_adv_steps;               // Advance steps for exit speed pressure
   #endif
 
+  #if ENABLED(NONLINEAR_EXTRUSION)
+    ne_fix_t ne;                            // Nonlinear extrusion coefficients in 8.24 fixed point
+    uint32_t ne_scale;                      // Step rate to E velocity (mm/s) in 8.24 fixed point
+  #endif
+
   uint32_t nominal_rate,                    // The nominal step rate for this block in step_events/sec
            initial_rate,                    // The jerk-adjusted step rate at start of block
            final_rate,                      // The minimal rate at exit
@@ -393,7 +403,7 @@ typedef struct PlannerSettings {
   typedef uvalue_t((BLOCK_BUFFER_SIZE) * 2) last_move_t;
 #endif
 
-#if ENABLED(ARC_SUPPORT)
+#if ANY(ARC_SUPPORT, BEZIER_CURVE_SUPPORT)
   #define HINTS_CURVE_RADIUS
   #define HINTS_SAFE_EXIT_SPEED
 #endif
@@ -442,6 +452,7 @@ class Planner {
     static volatile uint8_t block_buffer_head,      // Index of the next block to be pushed
                             block_buffer_nonbusy,   // Index of the first non busy block
                             block_buffer_tail;      // Index of the busy block, if any
+    static uint8_t block_buffer_planned;            // Index of the last block whose entry speed can no longer change
     static uint16_t cleaning_buffer_counter;        // A counter to disable queuing of blocks
     static uint8_t delay_before_delivering;         // This counter delays delivery of blocks when queue becomes empty to allow the opportunity of merging blocks
 
@@ -803,7 +814,7 @@ class Planner {
     FORCE_INLINE static uint8_t nonbusy_movesplanned() { return block_dec_mod(block_buffer_head, block_buffer_nonbusy); }
 
     // Remove all blocks from the buffer
-    FORCE_INLINE static void clear_block_buffer() { block_buffer_nonbusy = block_buffer_head = block_buffer_tail = 0; }
+    FORCE_INLINE static void clear_block_buffer() { block_buffer_planned = block_buffer_nonbusy = block_buffer_head = block_buffer_tail = 0; }
 
     // Check if movement queue is full
     FORCE_INLINE static bool is_full() { return block_buffer_tail == next_block_index(block_buffer_head); }
@@ -823,6 +834,9 @@ class Planner {
       // Wait until there are enough slots free
       while (moves_free() < count) { idle(); }
 
+      // The steppers consumed the planned block, so the slot is about to be reused
+      if (block_buffer_planned == block_buffer_head) block_buffer_planned = block_buffer_tail;
+
       // Return the first available block
       next_buffer_head = next_block_index(block_buffer_head);
       return &block_buffer[block_buffer_head];
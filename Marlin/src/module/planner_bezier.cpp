@@ -32,7 +32,6 @@
 
 #include "planner.h"
 #include "motion.h"
-#include "temperature.h"
 
 #include "../MarlinCore.h"
 #include "../gcode/queue.h"
@@ -66,6 +65,44 @@ static inline float eval_bezier(const_float_t a, const_float_t b, const_float_t
  */
 static inline float dist1(const_float_t x1, const_float_t y1, const_float_t x2, const_float_t y2) { return ABS(x1 - x2) + ABS(y1 - y2); }
 
+/**
+ * Radius of curvature of the curve at t, from the first and second derivatives:
+ *   R = |B'|^3 / |B' x B''|
+ * Returns 0 where the curve is straight, so the planner uses its own junction math.
+ */
+static float bezier_radius(const xy_pos_t &p0, const xy_pos_t &p1, const xy_pos_t &p2, const xy_pos_t &p3, const_float_t t) {
+  const float it = 1 - t;
+  const xy_pos_t d1 = (p1 - p0) * (3 * sq(it)) + (p2 - p1) * (6 * it * t) + (p3 - p2) * (3 * sq(t)),
+                 d2 = (p2 - p1 * 2 + p0) * (6 * it) + (p3 - p2 * 2 + p1) * (6 * t);
+  const float cross = ABS(d1.x * d2.y - d1.y * d2.x);
+  if (cross < 1e-6f) return 0;
+  const float speed = d1.magnitude();
+  return speed * sq(speed) / cross;
+}
+
+/**
+ * A lower bound of the radius of curvature for t in [a, b], or INFINITY where the curve is straight.
+ * With B'(t) = A t^2 + B t + C and B''(t) = 2A t + B, the cross product B' x B'' is the
+ * quadratic (B x A) t^2 + 2 (C x A) t + C x B, so its largest size in the interval is exact.
+ * |B'| is at least its value at the middle less the largest |B''| times the half width.
+ */
+static float bezier_min_radius(const xy_pos_t &p0, const xy_pos_t &p1, const xy_pos_t &p2, const xy_pos_t &p3, const_float_t a, const_float_t b) {
+  const xy_pos_t A = (p3 - p0 + (p1 - p2) * 3) * 3, B = (p2 - p1 * 2 + p0) * 6, C = (p1 - p0) * 3;
+  auto cross = [](const xy_pos_t &u, const xy_pos_t &v) { return u.x * v.y - u.y * v.x; };
+  const float k2 = cross(B, A), k1 = 2 * cross(C, A), k0 = cross(C, B);
+  auto k = [&](const_float_t t) { return ABS((k2 * t + k1) * t + k0); };
+  float k_max = _MAX(k(a), k(b));
+  if (k2) {
+    const float tv = -k1 / (2 * k2);
+    if (WITHIN(tv, a, b)) NOLESS(k_max, k(tv));
+  }
+  if (k_max < 1e-6f) return INFINITY;
+  const float m = 0.5f * (a + b),
+              accel = _MAX((A * (2 * a) + B).magnitude(), (A * (2 * b) + B).magnitude()),
+              speed = (A * sq(m) + B * m + C).magnitude() - accel * 0.5f * (b - a);
+  return speed > 0 ? speed * sq(speed) / k_max : 0;
+}
+
 /**
  * The algorithm for computing the step is loosely based on the one in Kig
  * (See https://sources.debian.net/src/kig/4:15.08.3-1/misc/kigpainter.cpp/#L759)
@@ -115,23 +152,34 @@ void cubic_b_spline(
   // Absolute first and second control points are recovered.
   const xy_pos_t first = position + offsets[0], second = target + offsets[1];
 
-  xyze_pos_t bez_target;
-  bez_target.set(position.x, position.y);
+  xyze_pos_t bez_target = position;
   float step = MAX_STEP;
 
-  millis_t next_idle_ms = millis() + 200UL;
-
   // Hints to help optimize the move
   PlannerHints hints;
 
-  for (float t = 0; t < 1;) {
+  // A segment can end at a speed which...
+  // a) is <= the XY maximum speeds and the requested feedrate,
+  // b) does not need more centripetal acceleration than the XY maximum at the sharpest point ahead,
+  // c) allows stopping in the straight-line distance to the end of the curve.
+  // The tightest radius ahead is bounded from below over each interval of t, so a tight
+  // spot between the ends of an interval still limits the speed before it.
+  const float limiting_accel = _MIN(planner.settings.max_acceleration_mm_per_s2[X_AXIS], planner.settings.max_acceleration_mm_per_s2[Y_AXIS]),
+              limiting_speed = _MIN(planner.settings.max_feedrate_mm_s[X_AXIS], planner.settings.max_feedrate_mm_s[Y_AXIS]),
+              limiting_speed_sqr = _MIN(sq(limiting_speed), sq(scaled_fr_mm_s));
 
-    thermalManager.task();
-    millis_t now = millis();
-    if (ELAPSED(now, next_idle_ms)) {
-      next_idle_ms = now + 200UL;
-      idle();
-    }
+  constexpr uint8_t radius_intervals = 16;
+  float min_radius_ahead[radius_intervals];
+  for (uint8_t i = radius_intervals; i--;) {
+    const float r = bezier_min_radius(position, first, second, target, float(i) / radius_intervals, float(i + 1) / radius_intervals);
+    min_radius_ahead[i] = i < radius_intervals - 1 ? _MIN(r, min_radius_ahead[i + 1]) : r;
+  }
+
+  for (float t = 0, r_end = 0; t < 1;) {
+
+    // Work out each segment only once the planner has room for it,
+    // so idle() keeps running while the curve waits for the planner.
+    while (planner.is_full()) idle();
 
     // First try to reduce the step in order to make it sufficiently
     // close to a linear interpolation.
@@ -180,7 +228,6 @@ void cubic_b_spline(
       }
     */
 
-    hints.millimeters = new_t - t;
     t = new_t;
 
     // Compute and send new position
@@ -198,6 +245,27 @@ void cubic_b_spline(
       /// FIXME: Wrong, since t is not linear in the distance.
     );
     apply_motion_limits(new_bez);
+
+    #if !SECONDARY_AXES
+      // Pass the segment length so the planner doesn't have to work it out
+      const xyz_pos_t seg = new_bez - bez_target;
+      hints.millimeters = seg.magnitude();
+    #endif
+
+    // The curvature at the end of the previous segment is that of the junction
+    hints.curve_radius = r_end;
+
+    // Find a speed from which the rest of the curve can be followed, or zero for the last segment
+    if (t < 1) {
+      float r_ahead = min_radius_ahead[uint8_t(t * radius_intervals)]; // From the interval holding t
+      r_end = bezier_radius(position, first, second, target, t);
+      if (r_end) NOMORE(r_ahead, r_end);
+      hints.safe_exit_speed_sqr = _MIN(limiting_speed_sqr, limiting_accel * r_ahead,
+                                       2 * limiting_accel * HYPOT(target.x - new_bez.x, target.y - new_bez.y));
+    }
+    else
+      hints.safe_exit_speed_sqr = 0;
+
     bez_target = new_bez;
 
     #if HAS_LEVELING && !PLANNER_LEVELING
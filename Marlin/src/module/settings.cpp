@@ -36,7 +36,7 @@
  */
 
 // Change EEPROM version if the structure changes
-#define EEPROM_VERSION "V91"
+#define EEPROM_VERSION "V92"
 #define EEPROM_OFFSET 100
 
 // Check the integrity of data offsets.
@@ -2472,7 +2472,12 @@ void MarlinSettings::postprocess() {
         _FIELD_TEST(user_thermistor);
         user_thermistor_t user_thermistor[USER_THERMISTORS];
         EEPROM_READ(user_thermistor);
-        if (!validating) COPY(thermalManager.user_thermistor, user_thermistor);
+        if (!validating) {
+          COPY(thermalManager.user_thermistor, user_thermistor);
+          #if ENABLED(THERMISTOR_DIRECT_USER)
+            for (uint8_t i = 0; i < USER_THERMISTORS; ++i) thermalManager.user_thermistor[i].pre_calc = true;
+          #endif
+        }
       }
       #endif
 
@@ -156,6 +156,14 @@ Stepper stepper; // Singleton
   #include "../HAL/ESP32/i2s.h"
 #endif
 
+#if ENABLED(REPLAY_BENCH)
+  #include "../tests/replay_bench.h"
+#endif
+
+#if ENABLED(ISR_TIMING)
+  #include "../feature/isr_timing.h"
+#endif
+
 // public:
 
 #if ANY(HAS_EXTRA_ENDSTOPS, Z_STEPPER_AUTO_ALIGN)
@@ -1505,7 +1513,8 @@ void Stepper::apply_directions() {
 HAL_STEP_TIMER_ISR() {
   HAL_timer_isr_prologue(MF_TIMER_STEP);
 
-  Stepper::isr();
+  // The replay benchmark runs the ISR itself on simulated time
+  if (TERN1(REPLAY_BENCH, !ReplayBench::running)) Stepper::isr();
 
   HAL_timer_isr_epilogue(MF_TIMER_STEP);
 }
@@ -1518,6 +1527,8 @@ HAL_STEP_TIMER_ISR() {
 
 void Stepper::isr() {
 
+  TERN_(ISR_TIMING, ISRTimingScope isr_timing(ISRTiming::STEPPER));
+
   static hal_timer_t nextMainISR = 0;  // Interval until the next main Stepper Pulse phase (0 = Now)
 
   #ifndef __AVR__
@@ -1738,6 +1749,8 @@ void Stepper::isr() {
  */
 void Stepper::pulse_phase_isr() {
 
+  TERN_(ISR_TIMING, ISRTimingScope isr_timing(ISRTiming::PULSE_PHASE));
+
   // If we must abort the current block, do so!
   if (abort_current_block) {
     abort_current_block = false;
@@ -2234,12 +2247,15 @@ hal_timer_t Stepper::calc_timer_interval(uint32_t step_rate) {
 }
 
 #if ENABLED(NONLINEAR_EXTRUSION)
-  void Stepper::calc_nonlinear_e(uint32_t step_rate) {
-    const uint32_t velocity = ne_scale * step_rate; // Scale step_rate first so all intermediate values stay in range of 8.24 fixed point math
-    int32_t vd =  (((((int64_t)ne_fix.A * velocity) >> 24) * velocity) >> 24) + (((int64_t)ne_fix.B * velocity) >> 24);
+  void Stepper::calc_nonlinear_e(const uint32_t step_rate) {
+    // Scale step_rate first so all intermediate values stay in range of 8.24 fixed point math.
+    // Every product is 32x32->64 bits, a single multiply instruction on Cortex-M3 and up.
+    const int32_t velocity = ne_scale * step_rate,
+                  av = (int64_t(ne_fix.A) * velocity) >> 24;
+    int32_t vd = ((int64_t(av) * velocity) >> 24) + ((int64_t(ne_fix.B) * velocity) >> 24);
     NOLESS(vd, 0);
 
-    advance_dividend.e = (uint64_t(ne_fix.C + vd) * ne_edividend) >> 24;
+    advance_dividend.e = (uint64_t(uint32_t(ne_fix.C + vd)) * uint32_t(ne_edividend)) >> 24;
   }
 #endif
 
@@ -2391,6 +2407,8 @@ void Stepper::set_axis_moved_for_current_block() {
  * have been done, so it is less time critical.
  */
 hal_timer_t Stepper::block_phase_isr() {
+  TERN_(ISR_TIMING, ISRTimingScope isr_timing(ISRTiming::BLOCK_PHASE));
+
   #if DISABLED(OLD_ADAPTIVE_MULTISTEPPING)
     // If the ISR uses < 50% of MPU time, halve multi-stepping
     const hal_timer_t time_spent = HAL_timer_get_count(MF_TIMER_STEP);
@@ -2830,18 +2848,10 @@ hal_timer_t Stepper::block_phase_isr() {
       #endif
 
       #if ENABLED(NONLINEAR_EXTRUSION)
+        // The planner already converted the coefficients to fixed point
         ne_edividend = advance_dividend.e;
-        const float scale = (float(ne_edividend) / advance_divisor) * planner.mm_per_step[E_AXIS_N(current_block->extruder)];
-        ne_scale = (1L << 24) * scale;
-        if (current_block->direction_bits.e && ANY_AXIS_MOVES(current_block)) {
-          ne_fix.A = (1L << 24) * ne.A;
-          ne_fix.B = (1L << 24) * ne.B;
-          ne_fix.C = (1L << 24) * ne.C;
-        }
-        else {
-          ne_fix.A = ne_fix.B = 0;
-          ne_fix.C = (1L << 24);
-        }
+        ne_scale = current_block->ne_scale >> oversampling_factor;
+        ne_fix = current_block->ne;
       #endif
 
       // Calculate the initial timer interval
@@ -281,17 +281,13 @@ constexpr ena_mask_t enable_overlap[] = {
 
 #endif // HAS_ZV_SHAPING
 
-#if ENABLED(NONLINEAR_EXTRUSION)
-  typedef struct { float A, B, C; void reset() { A = B = 0.0f; C = 1.0f; } } ne_coeff_t;
-  typedef struct { int32_t A, B, C; } ne_fix_t;
-#endif
-
 //
 // Stepper class definition
 //
 class Stepper {
   friend class Max7219;
   friend class FTMotion;
+  friend class ReplayBench;
   friend void stepperTask(void *);
 
   public:
@@ -710,7 +706,7 @@ class Stepper {
     static void set_axis_moved_for_current_block();
 
     #if ENABLED(NONLINEAR_EXTRUSION)
-      static void calc_nonlinear_e(uint32_t step_rate);
+      static void calc_nonlinear_e(const uint32_t step_rate);
     #endif
 
     #if ENABLED(S_CURVE_ACCELERATION)
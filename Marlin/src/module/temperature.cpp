@@ -37,6 +37,10 @@
 #include "planner.h"
 #include "printcounter.h"
 
+#if ENABLED(THERMISTOR_DIRECT_LOOKUP)
+  #include "thermistor/thermistor_direct.h"
+#endif
+
 #if ANY(HAS_COOLER, LASER_COOLANT_FLOW_METER)
   #include "../feature/cooler.h"
   #include "../feature/spindle_laser.h"
@@ -52,6 +56,9 @@
 
 #if ENABLED(DWIN_LCD_PROUI)
   #include "../lcd/e3v2/proui/dwin.h"
+  #ifdef PROUI_TEMP_HISTORY
+    #include "../lcd/e3v2/proui/temp_history.h"
+  #endif
 #endif
 
 #if ENABLED(EXTENSIBLE_UI)
@@ -234,6 +241,10 @@
   #include "servo.h"
 #endif
 
+#if ENABLED(ISR_TIMING)
+  #include "../feature/isr_timing.h"
+#endif
+
 #if ANY(TEMP_SENSOR_0_IS_THERMISTOR, TEMP_SENSOR_1_IS_THERMISTOR, TEMP_SENSOR_2_IS_THERMISTOR, TEMP_SENSOR_3_IS_THERMISTOR, \
         TEMP_SENSOR_4_IS_THERMISTOR, TEMP_SENSOR_5_IS_THERMISTOR, TEMP_SENSOR_6_IS_THERMISTOR, TEMP_SENSOR_7_IS_THERMISTOR )
   #define HAS_HOTEND_THERMISTOR 1
@@ -244,6 +255,10 @@
   #define NEXT_TEMPTABLE_LEN(N) ,TEMPTABLE_##N##_LEN
   static const temp_entry_t* heater_ttbl_map[HOTENDS] = ARRAY_BY_HOTENDS(TEMPTABLE_0 REPEAT_S(1, HOTENDS, NEXT_TEMPTABLE));
   static constexpr uint8_t heater_ttbllen_map[HOTENDS] = ARRAY_BY_HOTENDS(TEMPTABLE_0_LEN REPEAT_S(1, HOTENDS, NEXT_TEMPTABLE_LEN));
+  #if ENABLED(THERMISTOR_DIRECT_LOOKUP)
+    #define NEXT_TT_DIRECT(N) ,TT_DIRECT_##N
+    static const int16_t* const heater_direct_map[HOTENDS] = ARRAY_BY_HOTENDS(TT_DIRECT_0 REPEAT_S(1, HOTENDS, NEXT_TT_DIRECT));
+  #endif
 #endif
 
 Temperature thermalManager;
@@ -2291,6 +2306,19 @@ void Temperature::task() {
   }                                                                       \
 }while(0)
 
+/**
+ * Convert with the sensor's direct table, if it has one, or search its table.
+ */
+#if ENABLED(THERMISTOR_DIRECT_LOOKUP)
+  #define THERMISTOR_TO_CELSIUS(N) do{ \
+    constexpr const int16_t *dtbl = TT_DIRECT_##N; \
+    if (dtbl) return thermistor_direct_lookup_P(dtbl, raw); \
+    SCAN_THERMISTOR_TABLE(TEMPTABLE_##N, TEMPTABLE_##N##_LEN); \
+  }while(0)
+#else
+  #define THERMISTOR_TO_CELSIUS(N) SCAN_THERMISTOR_TABLE(TEMPTABLE_##N, TEMPTABLE_##N##_LEN)
+#endif
+
 #if HAS_USER_THERMISTORS
 
   user_thermistor_t Temperature::user_thermistor[USER_THERMISTORS]; // Initialized by settings.load()
@@ -2375,20 +2403,8 @@ void Temperature::task() {
     );
   }
 
-  celsius_float_t Temperature::user_thermistor_to_deg_c(const uint8_t t_index, const raw_adc_t raw) {
-
-    if (!WITHIN(t_index, 0, COUNT(user_thermistor) - 1)) return 25;
-
-    user_thermistor_t &t = user_thermistor[t_index];
-    if (t.pre_calc) { // pre-calculate some variables
-      t.pre_calc     = false;
-      t.res_25_recip = 1.0f / t.res_25;
-      t.res_25_log   = logf(t.res_25);
-      t.beta_recip   = 1.0f / t.beta;
-      t.sh_alpha     = RECIPROCAL(THERMISTOR_RESISTANCE_NOMINAL_C - (THERMISTOR_ABS_ZERO_C))
-                        - (t.beta_recip * t.res_25_log) - (t.sh_c_coeff * cu(t.res_25_log));
-    }
-
+  // Steinhart-Hart temperature for a raw value
+  static celsius_float_t user_thermistor_curve(const user_thermistor_t &t, const raw_adc_t raw) {
     // Maximum ADC value .. take into account the over sampling
     constexpr raw_adc_t adc_max = MAX_RAW_THERMISTOR_VALUE;
     const raw_adc_t adc_raw = constrain(raw, 1, adc_max - 1); // constrain to prevent divide-by-zero
@@ -2406,6 +2422,35 @@ void Temperature::task() {
     // Return degrees C (up to 999, as the LCD only displays 3 digits)
     return _MIN(value + THERMISTOR_ABS_ZERO_C, 999);
   }
+
+  #if ENABLED(THERMISTOR_DIRECT_USER)
+    static int16_t user_thermistor_direct[USER_THERMISTORS][THERMISTOR_DIRECT_SIZE];
+  #endif
+
+  celsius_float_t Temperature::user_thermistor_to_deg_c(const uint8_t t_index, const raw_adc_t raw) {
+
+    if (!WITHIN(t_index, 0, COUNT(user_thermistor) - 1)) return 25;
+
+    user_thermistor_t &t = user_thermistor[t_index];
+    if (t.pre_calc) { // pre-calculate some variables
+      t.pre_calc     = false;
+      t.res_25_recip = 1.0f / t.res_25;
+      t.res_25_log   = logf(t.res_25);
+      t.beta_recip   = 1.0f / t.beta;
+      t.sh_alpha     = RECIPROCAL(THERMISTOR_RESISTANCE_NOMINAL_C - (THERMISTOR_ABS_ZERO_C))
+                        - (t.beta_recip * t.res_25_log) - (t.sh_c_coeff * cu(t.res_25_log));
+
+      #if ENABLED(THERMISTOR_DIRECT_USER)
+        // Resample the curve for direct lookup
+        for (uint16_t i = 0; i < THERMISTOR_DIRECT_SIZE; ++i) {
+          const raw_adc_t r = _MIN(uint32_t(i) << thermistor_direct_shift, uint32_t(MAX_RAW_THERMISTOR_VALUE));
+          user_thermistor_direct[t_index][i] = thermistor_direct_fix(_MAX(user_thermistor_curve(t, r), -999.0f));
+        }
+      #endif
+    }
+
+    return TERN(THERMISTOR_DIRECT_USER, thermistor_direct_lookup(user_thermistor_direct[t_index], raw), user_thermistor_curve(t, raw));
+  }
 #endif
 
 #if HAS_HOTEND
@@ -2420,6 +2465,11 @@ void Temperature::task() {
       return 0;
     }
 
+    #if HAS_HOTEND_THERMISTOR && ENABLED(THERMISTOR_DIRECT_LOOKUP)
+      // Table thermistors go straight to their direct table
+      if (heater_direct_map[e]) return thermistor_direct_lookup_P(heater_direct_map[e], raw);
+    #endif
+
     switch (e) {
       case 0:
         #if TEMP_SENSOR_0_IS_CUSTOM
@@ -2556,7 +2606,7 @@ void Temperature::task() {
         return (int16_t)raw * 0.25f;
       #endif
     #elif TEMP_SENSOR_BED_IS_THERMISTOR
-      SCAN_THERMISTOR_TABLE(TEMPTABLE_BED, TEMPTABLE_BED_LEN);
+      THERMISTOR_TO_CELSIUS(BED);
     #elif TEMP_SENSOR_BED_IS_AD595
       return TEMP_AD595(raw);
     #elif TEMP_SENSOR_BED_IS_AD8495
@@ -2574,7 +2624,7 @@ void Temperature::task() {
     #if TEMP_SENSOR_CHAMBER_IS_CUSTOM
       return user_thermistor_to_deg_c(CTI_CHAMBER, raw);
     #elif TEMP_SENSOR_CHAMBER_IS_THERMISTOR
-      SCAN_THERMISTOR_TABLE(TEMPTABLE_CHAMBER, TEMPTABLE_CHAMBER_LEN);
+      THERMISTOR_TO_CELSIUS(CHAMBER);
     #elif TEMP_SENSOR_CHAMBER_IS_AD595
       return TEMP_AD595(raw);
     #elif TEMP_SENSOR_CHAMBER_IS_AD8495
@@ -2592,7 +2642,7 @@ void Temperature::task() {
     #if TEMP_SENSOR_COOLER_IS_CUSTOM
       return user_thermistor_to_deg_c(CTI_COOLER, raw);
     #elif TEMP_SENSOR_COOLER_IS_THERMISTOR
-      SCAN_THERMISTOR_TABLE(TEMPTABLE_COOLER, TEMPTABLE_COOLER_LEN);
+      THERMISTOR_TO_CELSIUS(COOLER);
     #elif TEMP_SENSOR_COOLER_IS_AD595
       return TEMP_AD595(raw);
     #elif TEMP_SENSOR_COOLER_IS_AD8495
@@ -2610,7 +2660,7 @@ void Temperature::task() {
     #if TEMP_SENSOR_PROBE_IS_CUSTOM
       return user_thermistor_to_deg_c(CTI_PROBE, raw);
     #elif TEMP_SENSOR_PROBE_IS_THERMISTOR
-      SCAN_THERMISTOR_TABLE(TEMPTABLE_PROBE, TEMPTABLE_PROBE_LEN);
+      THERMISTOR_TO_CELSIUS(PROBE);
     #elif TEMP_SENSOR_PROBE_IS_AD595
       return TEMP_AD595(raw);
     #elif TEMP_SENSOR_PROBE_IS_AD8495
@@ -2628,7 +2678,7 @@ void Temperature::task() {
     #if TEMP_SENSOR_BOARD_IS_CUSTOM
       return user_thermistor_to_deg_c(CTI_BOARD, raw);
     #elif TEMP_SENSOR_BOARD_IS_THERMISTOR
-      SCAN_THERMISTOR_TABLE(TEMPTABLE_BOARD, TEMPTABLE_BOARD_LEN);
+      THERMISTOR_TO_CELSIUS(BOARD);
     #elif TEMP_SENSOR_BOARD_IS_AD595
       return TEMP_AD595(raw);
     #elif TEMP_SENSOR_BOARD_IS_AD8495
@@ -2666,7 +2716,7 @@ void Temperature::task() {
     #elif TEMP_SENSOR_IS_MAX_TC(REDUNDANT) && REDUNDANT_TEMP_MATCH(SOURCE, E2)
       return TERN(TEMP_SENSOR_REDUNDANT_IS_MAX31865, max31865_2.temperature(raw), (int16_t)raw * 0.25f);
     #elif TEMP_SENSOR_REDUNDANT_IS_THERMISTOR
-      SCAN_THERMISTOR_TABLE(TEMPTABLE_REDUNDANT, TEMPTABLE_REDUNDANT_LEN);
+      THERMISTOR_TO_CELSIUS(REDUNDANT);
     #elif TEMP_SENSOR_REDUNDANT_IS_AD595
       return TEMP_AD595(raw);
     #elif TEMP_SENSOR_REDUNDANT_IS_AD8495
@@ -2722,6 +2772,10 @@ void Temperature::updateTemperaturesFromRawValues() {
   TERN_(HAS_TEMP_SOC,       temp_soc.celsius       = analog_to_celsius_soc(temp_soc.getraw()));
   TERN_(HAS_TEMP_REDUNDANT, temp_redundant.celsius = analog_to_celsius_redundant(temp_redundant.getraw()));
 
+  #ifdef PROUI_TEMP_HISTORY
+    tempHistory.record();
+  #endif
+
   TERN_(FILAMENT_WIDTH_SENSOR, filwidth.update_measured_mm());
   TERN_(HAS_POWER_MONITOR,     power_monitor.capture_values());
 
@@ -3859,6 +3913,8 @@ public:
  */
 void Temperature::isr() {
 
+  TERN_(ISR_TIMING, ISRTimingScope isr_timing(ISRTiming::TEMPERATURE));
+
   // Shut down the laser if steppers are inactive for > LASER_SAFETY_TIMEOUT_MS ms
   #if LASER_SAFETY_TIMEOUT_MS > 0
     if (cutter.last_power_applied && ELAPSED(millis(), gcode.previous_move_ms + (LASER_SAFETY_TIMEOUT_MS))) {
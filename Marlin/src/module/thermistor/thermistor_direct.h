@@ -0,0 +1,212 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2020 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+#pragma once
+
+/**
+ * Direct-index thermistor tables
+ *
+ * Each thermistor table is resampled at compile time into 2^THERMISTOR_DIRECT_BITS
+ * equal segments spanning the raw (oversampled) ADC range, stored in 1/16 °C.
+ * The top bits of the raw value pick the segment and the low bits interpolate.
+ *
+ * A table is checked against its source at every source point between
+ * THERMISTOR_DIRECT_CHECK_MIN and THERMISTOR_DIRECT_CHECK_MAX. Both curves
+ * are linear between those points, so this bounds the error everywhere to
+ * within one table unit.
+ */
+
+#include "thermistors.h"
+
+#define THERMISTOR_DIRECT_SIZE  (_BV(THERMISTOR_DIRECT_BITS) + 1)
+#define THERMISTOR_DIRECT_SCALE 16 // Table units per °C
+
+// Bits in a raw (oversampled) thermistor reading
+constexpr uint8_t thermistor_raw_bits() {
+  uint8_t b = 0;
+  while ((1UL << b) < uint32_t(MAX_RAW_THERMISTOR_VALUE) + 1) ++b;
+  return b;
+}
+static_assert(_BV32(thermistor_raw_bits()) == uint32_t(MAX_RAW_THERMISTOR_VALUE) + 1, "Direct thermistor lookup requires a power-of-2 raw ADC range.");
+static_assert(thermistor_raw_bits() >= THERMISTOR_DIRECT_BITS, "THERMISTOR_DIRECT_BITS can't exceed the raw ADC resolution.");
+
+constexpr uint8_t thermistor_direct_shift = thermistor_raw_bits() - (THERMISTOR_DIRECT_BITS);
+constexpr uint32_t thermistor_direct_mask = _BV32(thermistor_direct_shift) - 1;
+
+typedef struct { int16_t temp[THERMISTOR_DIRECT_SIZE]; } thermistor_direct_t;
+
+// Interpolate between two table points in 1/16 °C
+constexpr int32_t thermistor_direct_interp(const int16_t t0, const int16_t t1, const uint32_t raw) {
+  return t0 + ((int32_t(t1 - t0) * int32_t(raw & thermistor_direct_mask)) >> thermistor_direct_shift);
+}
+
+// Convert a raw value with a table in flash
+FORCE_INLINE celsius_float_t thermistor_direct_lookup_P(const int16_t * const tbl, const raw_adc_t raw) {
+  const raw_adc_t r = _MIN(raw, raw_adc_t(MAX_RAW_THERMISTOR_VALUE));
+  const uint16_t i = r >> thermistor_direct_shift;
+  return thermistor_direct_interp(int16_t(pgm_read_word(&tbl[i])), int16_t(pgm_read_word(&tbl[i + 1])), r) * (1.0f / (THERMISTOR_DIRECT_SCALE));
+}
+
+// Convert a raw value with a table in RAM
+FORCE_INLINE celsius_float_t thermistor_direct_lookup(const int16_t * const tbl, const raw_adc_t raw) {
+  const raw_adc_t r = _MIN(raw, raw_adc_t(MAX_RAW_THERMISTOR_VALUE));
+  const uint16_t i = r >> thermistor_direct_shift;
+  return thermistor_direct_interp(tbl[i], tbl[i + 1], r) * (1.0f / (THERMISTOR_DIRECT_SCALE));
+}
+
+// Round °C to table units
+constexpr int16_t thermistor_direct_fix(const float c) {
+  return int16_t(c * (THERMISTOR_DIRECT_SCALE) + (c < 0 ? -0.5f : 0.5f));
+}
+
+// The source table's temperature for a raw value, as found by SCAN_THERMISTOR_TABLE
+constexpr float thermistor_table_temp(const temp_entry_t * const tbl, const uint8_t len, const uint32_t raw) {
+  if (raw <= tbl[0].value) return tbl[0].celsius;
+  for (uint8_t i = 1; i < len; ++i)
+    if (raw <= tbl[i].value)
+      return tbl[i - 1].celsius + (raw - tbl[i - 1].value) * float(tbl[i].celsius - tbl[i - 1].celsius) / float(tbl[i].value - tbl[i - 1].value);
+  return tbl[len - 1].celsius;
+}
+
+constexpr thermistor_direct_t thermistor_direct_table(const temp_entry_t * const tbl, const uint8_t len) {
+  thermistor_direct_t d{};
+  for (uint16_t i = 0; i < THERMISTOR_DIRECT_SIZE; ++i)
+    d.temp[i] = thermistor_direct_fix(thermistor_table_temp(tbl, len, uint32_t(i) << thermistor_direct_shift));
+  return d;
+}
+
+// Largest deviation (°C) from the source table within the checked range
+constexpr float thermistor_direct_error(const thermistor_direct_t &d, const temp_entry_t * const tbl, const uint8_t len) {
+  float err = 0;
+  for (uint8_t i = 0; i < len; ++i) {
+    if (!WITHIN(tbl[i].celsius, THERMISTOR_DIRECT_CHECK_MIN, THERMISTOR_DIRECT_CHECK_MAX)) continue;
+    const uint32_t raw = _MIN(tbl[i].value, uint32_t(MAX_RAW_THERMISTOR_VALUE)),
+                   s = raw >> thermistor_direct_shift;
+    const float c = float(thermistor_direct_interp(d.temp[s], d.temp[s + 1], raw)) / (THERMISTOR_DIRECT_SCALE),
+                e = ABS(c - thermistor_table_temp(tbl, len, raw));
+    if (e > err) err = e;
+  }
+  return err;
+}
+
+// One flash table per distinct source table
+template<const temp_entry_t *TBL, uint8_t LEN>
+struct ThermistorDirect {
+  static constexpr thermistor_direct_t table PROGMEM = thermistor_direct_table(TBL, LEN);
+  static constexpr float error = thermistor_direct_error(table, TBL, LEN);
+};
+
+// Definition for pre-C++17 builds, which take the table's address
+template<const temp_entry_t *TBL, uint8_t LEN>
+constexpr thermistor_direct_t ThermistorDirect<TBL, LEN>::table;
+
+#define _TT_DIRECT(N) ThermistorDirect<TEMPTABLE_##N, TEMPTABLE_##N##_LEN>
+#define TT_DIRECT_NONE ((const int16_t*)nullptr)
+#define CHECK_TT_DIRECT(N) static_assert(_TT_DIRECT(N)::error <= (THERMISTOR_DIRECT_MAX_ERROR), \
+  "thermistor_" STRINGIFY(TEMP_SENSOR_##N) ".h direct lookup error exceeds THERMISTOR_DIRECT_MAX_ERROR. Increase THERMISTOR_DIRECT_BITS.");
+
+// Table thermistors get a direct table. Custom and dummy sensors don't.
+#define _TT_DIRECT_USED(N) (TEMP_SENSOR_##N##_IS_THERMISTOR && !TEMP_SENSOR_##N##_IS_CUSTOM && !TEMP_SENSOR_##N##_IS_DUMMY)
+
+#if _TT_DIRECT_USED(0)
+  #define TT_DIRECT_0 _TT_DIRECT(0)::table.temp
+  CHECK_TT_DIRECT(0)
+#else
+  #define TT_DIRECT_0 TT_DIRECT_NONE
+#endif
+#if _TT_DIRECT_USED(1)
+  #define TT_DIRECT_1 _TT_DIRECT(1)::table.temp
+  CHECK_TT_DIRECT(1)
+#else
+  #define TT_DIRECT_1 TT_DIRECT_NONE
+#endif
+#if _TT_DIRECT_USED(2)
+  #define TT_DIRECT_2 _TT_DIRECT(2)::table.temp
+  CHECK_TT_DIRECT(2)
+#else
+  #define TT_DIRECT_2 TT_DIRECT_NONE
+#endif
+#if _TT_DIRECT_USED(3)
+  #define TT_DIRECT_3 _TT_DIRECT(3)::table.temp
+  CHECK_TT_DIRECT(3)
+#else
+  #define TT_DIRECT_3 TT_DIRECT_NONE
+#endif
+#if _TT_DIRECT_USED(4)
+  #define TT_DIRECT_4 _TT_DIRECT(4)::table.temp
+  CHECK_TT_DIRECT(4)
+#else
+  #define TT_DIRECT_4 TT_DIRECT_NONE
+#endif
+#if _TT_DIRECT_USED(5)
+  #define TT_DIRECT_5 _TT_DIRECT(5)::table.temp
+  CHECK_TT_DIRECT(5)
+#else
+  #define TT_DIRECT_5 TT_DIRECT_NONE
+#endif
+#if _TT_DIRECT_USED(6)
+  #define TT_DIRECT_6 _TT_DIRECT(6)::table.temp
+  CHECK_TT_DIRECT(6)
+#else
+  #define TT_DIRECT_6 TT_DIRECT_NONE
+#endif
+#if _TT_DIRECT_USED(7)
+  #define TT_DIRECT_7 _TT_DIRECT(7)::table.temp
+  CHECK_TT_DIRECT(7)
+#else
+  #define TT_DIRECT_7 TT_DIRECT_NONE
+#endif
+#if _TT_DIRECT_USED(BED)
+  #define TT_DIRECT_BED _TT_DIRECT(BED)::table.temp
+  CHECK_TT_DIRECT(BED)
+#else
+  #define TT_DIRECT_BED TT_DIRECT_NONE
+#endif
+#if _TT_DIRECT_USED(CHAMBER)
+  #define TT_DIRECT_CHAMBER _TT_DIRECT(CHAMBER)::table.temp
+  CHECK_TT_DIRECT(CHAMBER)
+#else
+  #define TT_DIRECT_CHAMBER TT_DIRECT_NONE
+#endif
+#if _TT_DIRECT_USED(PROBE)
+  #define TT_DIRECT_PROBE _TT_DIRECT(PROBE)::table.temp
+  CHECK_TT_DIRECT(PROBE)
+#else
+  #define TT_DIRECT_PROBE TT_DIRECT_NONE
+#endif
+#if _TT_DIRECT_USED(COOLER)
+  #define TT_DIRECT_COOLER _TT_DIRECT(COOLER)::table.temp
+  CHECK_TT_DIRECT(COOLER)
+#else
+  #define TT_DIRECT_COOLER TT_DIRECT_NONE
+#endif
+#if _TT_DIRECT_USED(BOARD)
+  #define TT_DIRECT_BOARD _TT_DIRECT(BOARD)::table.temp
+  CHECK_TT_DIRECT(BOARD)
+#else
+  #define TT_DIRECT_BOARD TT_DIRECT_NONE
+#endif
+#if _TT_DIRECT_USED(REDUNDANT)
+  #define TT_DIRECT_REDUNDANT _TT_DIRECT(REDUNDANT)::table.temp
+  CHECK_TT_DIRECT(REDUNDANT)
+#else
+  #define TT_DIRECT_REDUNDANT TT_DIRECT_NONE
+#endif
@@ -150,6 +150,12 @@ MediaFile CardReader::file;
 
 uint32_t CardReader::filesize, CardReader::sdpos;
 
+#if ENABLED(SD_READ_AHEAD)
+  uint8_t CardReader::ra_buffer[SD_READ_AHEAD_BLOCKS][512];
+  uint16_t CardReader::ra_len[SD_READ_AHEAD_BLOCKS], CardReader::ra_offset; // = 0
+  uint8_t CardReader::ra_head, CardReader::ra_count; // = 0
+#endif
+
 CardReader::CardReader() {
   changeMedia(&
     #if HAS_USB_FLASH_DRIVE && !SHARED_VOLUME_IS(SD_ONBOARD)
@@ -628,6 +634,7 @@ void CardReader::endFilePrintNow(TERN_(SD_RESORT, const bool re_sort/*=false*/))
   TERN_(ADVANCED_PAUSE_FEATURE, did_pause_print = 0);
   flag.abort_sd_printing = false;
   if (isFileOpen()) file.close();
+  TERN_(SD_READ_AHEAD, read_ahead_reset());
   TERN_(SD_RESORT, if (re_sort) presort());
 }
 
@@ -732,6 +739,7 @@ void CardReader::openFileRead(const char * const path, const uint8_t subcall_typ
   if (file.open(diveDir, fname, O_READ)) {
     filesize = file.fileSize();
     sdpos = 0;
+    TERN_(SD_READ_AHEAD, read_ahead_reset());
 
     { // Don't remove this block, as the PORT_REDIRECT is a RAII
       PORT_REDIRECT(SerialMask::All);
@@ -991,6 +999,7 @@ void CardReader::closefile(const bool store_location/*=false*/) {
   file.close();
   flag.saving = flag.logging = false;
   sdpos = 0;
+  TERN_(SD_READ_AHEAD, read_ahead_reset());
   TERN_(EMERGENCY_PARSER, emergency_parser.enable());
 
   if (store_location) {
@@ -1410,6 +1419,34 @@ int16_t CardReader::get_num_items() {
   return nrItems;
 }
 
+#if ENABLED(SD_READ_AHEAD)
+
+  /**
+   * Read the next block of the open file into the read-ahead buffer.
+   * The first read after a seek stops at a block boundary, so the rest
+   * go straight from the card into the buffer, bypassing the volume cache.
+   */
+  bool CardReader::read_ahead() {
+    if (ra_count >= SD_READ_AHEAD_BLOCKS || !file.isOpen()) return true;
+    const uint32_t pos = file.curPosition();
+    if (pos >= filesize) return true;
+    const uint8_t i = (ra_head + ra_count) % (SD_READ_AHEAD_BLOCKS);
+    const int16_t n = file.read(ra_buffer[i], 512 - (pos & 0x1FF));
+    if (n <= 0) return false;
+    ra_len[i] = n;
+    ra_count++;
+    return true;
+  }
+
+  int16_t CardReader::stream_peek(const uint8_t* &ptr) {
+    if (!ra_count && !read_ahead()) return -1;
+    if (!ra_count) return 0;
+    ptr = ra_buffer[ra_head] + ra_offset;
+    return ra_len[ra_head] - ra_offset;
+  }
+
+#endif // SD_READ_AHEAD
+
 //
 // Return from procedure or close out the Print Job
 //
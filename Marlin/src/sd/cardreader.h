@@ -234,13 +234,28 @@ public:
   static uint32_t getFileSize()  { return filesize; }
   static uint32_t getIndex()     { return sdpos; }
   static bool isFileOpen()       { return isMounted() && file.isOpen(); }
+  static bool getDirEntry(dir_t * const d) { return file.dirEntry(d); }
   static bool eof()              { return getIndex() >= getFileSize(); }
 
   // File data operations
-  static int16_t get()                            { int16_t out = (int16_t)file.read(); sdpos = file.curPosition(); return out; }
-  static int16_t read(void *buf, uint16_t nbyte)  { return file.isOpen() ? file.read(buf, nbyte) : -1; }
+  static int16_t get()                            { TERN_(SD_READ_AHEAD, read_ahead_sync()); int16_t out = (int16_t)file.read(); sdpos = file.curPosition(); return out; }
+  static int16_t read(void *buf, uint16_t nbyte)  { TERN_(SD_READ_AHEAD, read_ahead_sync()); return file.isOpen() ? file.read(buf, nbyte) : -1; }
   static int16_t write(void *buf, uint16_t nbyte) { return file.isOpen() ? file.write(buf, nbyte) : -1; }
-  static void setIndex(const uint32_t index)      { file.seekSet((sdpos = index)); }
+  static void setIndex(const uint32_t index)      { TERN_(SD_READ_AHEAD, read_ahead_reset()); file.seekSet((sdpos = index)); }
+
+  #if ENABLED(SD_READ_AHEAD)
+    // Buffered reading of the file being printed
+    static bool read_ahead();                         // Read one more block if there's room. False on error.
+    static int16_t stream_peek(const uint8_t* &ptr);  // Buffered bytes at sdpos, reading a block if empty. -1 on error.
+    static void stream_consume(const uint16_t n) {    // Advance sdpos by n peeked bytes
+      sdpos += n;
+      if ((ra_offset += n) >= ra_len[ra_head]) {
+        ra_offset = 0;
+        ra_head = (ra_head + 1) % (SD_READ_AHEAD_BLOCKS);
+        ra_count--;
+      }
+    }
+  #endif
 
   /// TODO: rename to diskIODriver()
   static DiskIODriver* diskIODriver() { return driver; }
@@ -333,6 +348,16 @@ private:
   static uint32_t filesize, // Total size of the current file, in bytes
                   sdpos;    // Index most recently read (one behind file.getPos)
 
+  #if ENABLED(SD_READ_AHEAD)
+    // Blocks read ahead of sdpos. The file position is at the end of the last one.
+    static uint8_t ra_buffer[SD_READ_AHEAD_BLOCKS][512];
+    static uint16_t ra_len[SD_READ_AHEAD_BLOCKS], // Bytes in each block
+                    ra_offset;                    // Bytes already consumed from the head block
+    static uint8_t ra_head, ra_count;
+    static void read_ahead_reset() { ra_count = 0; ra_offset = 0; }
+    static void read_ahead_sync() { if (ra_count) { read_ahead_reset(); file.seekSet(sdpos); } }
+  #endif
+
   //
   // Procedure calls to other files
   //
@@ -0,0 +1,152 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2024 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "../inc/MarlinConfig.h"
+
+#if ENABLED(INGEST_BENCH)
+
+#include "ingest_bench.h"
+#include "../gcode/queue_stream.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+static uint64_t nanos() {
+  timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return uint64_t(ts.tv_sec) * 1000000000ULL + ts.tv_nsec;
+}
+
+// Commands found, and a hash of their text to compare the two paths
+typedef struct { uint32_t lines, hash; } ingest_result_t;
+
+// Finish a line like process_line_done()
+template<bool HASH>
+static void commit_line(ingest_result_t &r, uint8_t &sis, char (&buff)[MAX_CMD_SIZE], int &ind) {
+  sis = PS_NORMAL;
+  buff[ind] = '\0';
+  if (!ind) return;
+  r.lines++;
+  if (HASH) {
+    for (const char *c = buff; *c; ++c) r.hash = (r.hash ^ uint8_t(*c)) * 16777619UL; // FNV-1a
+    r.hash = (r.hash ^ '\n') * 16777619UL;
+  }
+  else
+    r.hash += uint8_t(buff[0]);
+  ind = 0;
+}
+
+template<bool HASH>
+static ingest_result_t ingest_per_char(const uint8_t * const data, const uint32_t size) {
+  ingest_result_t r = { 0, 2166136261UL };
+  char buff[MAX_CMD_SIZE];
+  uint8_t sis = PS_NORMAL;
+  int ind = 0;
+  for (uint32_t p = 0; p < size; ++p) {
+    const char c = data[p];
+    if (ISEOL(c))
+      commit_line<HASH>(r, sis, buff, ind);
+    else
+      process_stream_char(c, sis, buff, ind);
+  }
+  commit_line<HASH>(r, sis, buff, ind);
+  return r;
+}
+
+template<bool HASH>
+static ingest_result_t ingest_blocks(const uint8_t * const data, const uint32_t size) {
+  ingest_result_t r = { 0, 2166136261UL };
+  char buff[MAX_CMD_SIZE];
+  uint8_t sis = PS_NORMAL;
+  int ind = 0;
+  for (uint32_t p = 0; p < size; p += 512) {
+    const uint8_t * const blk = data + p;
+    const uint16_t len = _MIN(size - p, 512UL);
+    for (uint16_t i = 0; i < len;) {
+      i += process_stream_block(blk + i, len - i, sis, buff, ind);
+      if (i < len) { ++i; commit_line<HASH>(r, sis, buff, ind); }
+    }
+  }
+  commit_line<HASH>(r, sis, buff, ind);
+  return r;
+}
+
+template<typename F>
+static uint64_t time_runs(const uint16_t repeat, F fn) {
+  const uint64_t start_ns = nanos();
+  uint32_t sink = 0;
+  for (uint16_t n = 0; n < repeat; ++n) sink += fn().hash;
+  const uint64_t ns = nanos() - start_ns;
+  if (sink == 1) SERIAL_ECHOLNPGM(" "); // Keep the work from being optimized away
+  return ns;
+}
+
+static void report(FSTR_P const name, const uint32_t lines, const uint32_t bytes, const uint16_t repeat, const uint64_t ns) {
+  const double s = ns / 1e9;
+  SERIAL_ECHOLN(name, p_float_t(lines * double(repeat) / s / 1e6, 3), F("M lines/s, "),
+                p_float_t(bytes * double(repeat) / s / 1048576.0, 1), F(" MiB/s"));
+}
+
+void ingest_bench_run() {
+  const char *path = getenv("MARLIN_INGEST");
+  if (!path) path = "ingest.gcode";
+  FILE * const in = fopen(path, "rb");
+  if (!in) {
+    SERIAL_ECHOLNPGM("Ingest: Can't open ", path);
+    exit(EXIT_FAILURE);
+  }
+  fseek(in, 0, SEEK_END);
+  const uint32_t size = ftell(in);
+  fseek(in, 0, SEEK_SET);
+  uint8_t * const data = (uint8_t*)malloc(size + 1);
+  if (!data || fread(data, 1, size, in) != size) {
+    SERIAL_ECHOLNPGM("Ingest: Can't read ", path);
+    exit(EXIT_FAILURE);
+  }
+  fclose(in);
+
+  const char * const repeat_str = getenv("MARLIN_INGEST_REPEAT");
+  const uint16_t repeat = _MAX(1, repeat_str ? atoi(repeat_str) : 20);
+
+  // Both paths must split the file into the same commands
+  const ingest_result_t ref = ingest_per_char<true>(data, size),
+                        blk = ingest_blocks<true>(data, size);
+  if (ref.lines != blk.lines || ref.hash != blk.hash) {
+    SERIAL_ECHOLNPGM("Ingest: Mismatch! per-char ", ref.lines, " lines, block ", blk.lines, " lines");
+    exit(EXIT_FAILURE);
+  }
+
+  const uint64_t char_ns = time_runs(repeat, [&]{ return ingest_per_char<false>(data, size); }),
+                 block_ns = time_runs(repeat, [&]{ return ingest_blocks<false>(data, size); });
+
+  SERIAL_ECHOLNPGM("Ingest: ", ref.lines, " commands in ", size, " bytes, x", repeat);
+  report(F("per-char : "), ref.lines, size, repeat, char_ns);
+  report(F("block    : "), ref.lines, size, repeat, block_ns);
+  SERIAL_ECHOLNPGM("Speedup: ", p_float_t(double(char_ns) / block_ns, 2));
+
+  free(data);
+  exit(EXIT_SUCCESS);
+}
+
+#endif // INGEST_BENCH
@@ -0,0 +1,40 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2024 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+#pragma once
+
+/**
+ * Command queue ingest benchmark for the native simulator (env:simulator_linux_ingest_bench)
+ *
+ * Splits a G-code file into command lines, the way SD printing does, with
+ * both stream paths in gcode/queue_stream.h:
+ *   per-char : process_stream_char() for every byte, as with card.get()
+ *   block    : process_stream_block() over 512 byte blocks, as with SD_READ_AHEAD
+ *
+ * Both must produce the same commands. The file is split MARLIN_INGEST_REPEAT
+ * times (default 20) with each path and the rates are printed before exit.
+ *
+ * Usage:
+ *   pio run -e simulator_linux_ingest_bench
+ *   MARLIN_INGEST=print.gcode .pio/build/simulator_linux_ingest_bench/MarlinSimulator
+ */
+
+void ingest_bench_run();
@@ -0,0 +1,256 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2024 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "../inc/MarlinConfig.h"
+
+#if ENABLED(REPLAY_BENCH)
+
+#include "replay_bench.h"
+#include "../gcode/queue.h"
+#include "../module/planner.h"
+#include "../module/stepper.h"
+#if ENABLED(FT_MOTION)
+  #include "../module/ft_motion.h"
+#endif
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+ReplayBench replayBench;
+
+bool ReplayBench::running; // = false
+
+// What the planner did for each block in the buffer
+static struct {
+  uint32_t serial, plan_ns, recalc_ns;
+  uint8_t queued;
+} plan_info[BLOCK_BUFFER_SIZE];
+
+// What the Stepper is doing with the current block
+static struct {
+  const block_t *block;
+  uint64_t start_ticks, isr_ns;
+  uint32_t isr_calls;
+} exec;
+
+static uint32_t block_serial;
+static uint64_t sim_ticks;                // Simulated Stepper timer
+static hal_timer_t next_main_isr;         // Ticks until the next pulse / block phase
+#if ENABLED(FT_MOTION)
+  static hal_timer_t next_ftm_aux_isr;
+#endif
+static FILE *csv, *timeline;
+
+// Totals for the summary
+static uint32_t blocks_done;
+static uint64_t plan_ns_total, recalc_ns_total, isr_ns_total, isr_calls_total;
+static uint32_t plan_ns_max, recalc_ns_max;
+
+#define TICKS_TO_US(T) (double(T) * 1000000.0 / double(STEPPER_TIMER_RATE))
+
+uint64_t ReplayBench::nanos() {
+  timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return uint64_t(ts.tv_sec) * 1000000000ULL + ts.tv_nsec;
+}
+
+void ReplayBench::planned(const uint8_t index, const uint64_t start_ns, const uint64_t recalc_start_ns) {
+  if (!running) return;
+  const uint64_t now = nanos();
+  auto &p = plan_info[index];
+  p.serial = block_serial++;
+  p.plan_ns = now - start_ns;
+  p.recalc_ns = now - recalc_start_ns;
+  p.queued = planner.movesplanned();
+  plan_ns_total += p.plan_ns;
+  recalc_ns_total += p.recalc_ns;
+  NOLESS(plan_ns_max, p.plan_ns);
+  NOLESS(recalc_ns_max, p.recalc_ns);
+}
+
+/**
+ * One Stepper ISR on simulated time. This follows the standard motion
+ * path of Stepper::isr() with the pulse, block, Linear Advance and Input
+ * Shaping phases, but advances sim_ticks by the interval instead of
+ * programming the timer.
+ */
+void ReplayBench::tick() {
+  const uint8_t tail = planner.block_buffer_tail;
+  const uint64_t t0 = nanos();
+
+  hal_timer_t interval;
+
+  #if ENABLED(FT_MOTION)
+    if (ftMotion.cfg.active) {
+      if (!next_main_isr) { next_main_isr = FTM_MIN_TICKS; Stepper::ftMotion_stepper(); }
+      if (!next_ftm_aux_isr) next_ftm_aux_isr = (STEPPER_TIMER_RATE) / 400;
+      interval = _MIN(next_main_isr, next_ftm_aux_isr);
+      next_main_isr -= interval;
+      next_ftm_aux_isr -= interval;
+    }
+    else
+  #endif
+  {
+    TERN_(HAS_ZV_SHAPING, Stepper::shaping_isr());
+
+    if (!next_main_isr) Stepper::pulse_phase_isr();
+
+    #if ENABLED(LIN_ADVANCE)
+      if (!Stepper::nextAdvanceISR) {
+        Stepper::advance_isr();
+        Stepper::nextAdvanceISR = Stepper::la_interval;
+      }
+      else if (Stepper::nextAdvanceISR > Stepper::la_interval)
+        Stepper::nextAdvanceISR = Stepper::la_interval;
+    #endif
+
+    if (!next_main_isr) next_main_isr = Stepper::block_phase_isr();
+
+    interval = next_main_isr;
+    TERN_(INPUT_SHAPING_X, NOMORE(interval, ShapingQueue::peek_x()));
+    TERN_(INPUT_SHAPING_Y, NOMORE(interval, ShapingQueue::peek_y()));
+    TERN_(INPUT_SHAPING_Z, NOMORE(interval, ShapingQueue::peek_z()));
+    TERN_(LIN_ADVANCE, NOMORE(interval, Stepper::nextAdvanceISR));
+
+    next_main_isr -= interval;
+    TERN_(HAS_ZV_SHAPING, ShapingQueue::decrement_delays(interval));
+    TERN_(LIN_ADVANCE, if (Stepper::nextAdvanceISR != LA_ADV_NEVER) Stepper::nextAdvanceISR -= interval);
+  }
+
+  const uint32_t isr_ns = nanos() - t0;
+  isr_ns_total += isr_ns;
+  isr_calls_total++;
+
+  // A block finished (the tail moved on)
+  if (exec.block && tail != planner.block_buffer_tail) {
+    const auto &p = plan_info[tail];
+    exec.isr_calls++;
+    exec.isr_ns += isr_ns;
+    if (csv) fprintf(csv, "%u,%u,%u,%u,%u,%.1f,%.1f,%u,%llu\n",
+      p.serial, p.plan_ns, p.recalc_ns, p.queued, unsigned(exec.block->step_event_count),
+      TICKS_TO_US(exec.start_ticks), TICKS_TO_US(sim_ticks + interval),
+      exec.isr_calls, (unsigned long long)exec.isr_ns
+    );
+    blocks_done++;
+    exec.block = nullptr;
+  }
+  // The Stepper took a new block
+  else if (Stepper::current_block != exec.block) {
+    exec.block = Stepper::current_block;
+    exec.start_ticks = sim_ticks;
+    exec.isr_calls = 1;
+    exec.isr_ns = isr_ns;
+  }
+  else if (exec.block) {
+    exec.isr_calls++;
+    exec.isr_ns += isr_ns;
+  }
+
+  if (timeline)
+    fprintf(timeline, "%.2f,%d,%lu\n", TICKS_TO_US(sim_ticks),
+            exec.block ? int(plan_info[planner.block_buffer_tail].serial) : -1, (unsigned long)interval);
+
+  sim_ticks += interval;
+}
+
+// Called from idle(). The planner only idles here while it waits for a free
+// block or for moves to finish, so step until the oldest block is done.
+void ReplayBench::idle() {
+  if (!running) return;
+  const uint8_t tail = planner.block_buffer_tail;
+  // Bounded so an unexpected stall (e.g. a move that never finishes) can't hang the bench
+  for (uint32_t n = 0; n < 10000000UL && planner.has_blocks_queued() && tail == planner.block_buffer_tail; ++n) tick();
+}
+
+// Commands that wait on hardware that isn't simulated
+static bool skip_command(const char * const cmd) {
+  static const char * const skipped[] = { "M0", "M1", "M109", "M190", "M191", "M303", "M600" };
+  for (const char * const s : skipped) {
+    const size_t len = strlen(s);
+    if (!strncmp(cmd, s, len) && !NUMERIC(cmd[len])) return true;
+  }
+  return false;
+}
+
+void ReplayBench::run() {
+  const char *path = getenv("MARLIN_REPLAY");
+  if (!path) path = "replay.gcode";
+  FILE * const in = fopen(path, "r");
+  if (!in) {
+    SERIAL_ECHOLNPGM("Replay: Can't open ", path);
+    exit(EXIT_FAILURE);
+  }
+
+  const char *csv_path = getenv("MARLIN_REPLAY_CSV");
+  csv = fopen(csv_path ? csv_path : "replay.csv", "w");
+  if (csv) fputs("block,plan_ns,recalc_ns,queued,steps,start_us,end_us,isr_calls,isr_ns\n", csv);
+
+  const char * const timeline_path = getenv("MARLIN_REPLAY_TIMELINE");
+  if (timeline_path) {
+    timeline = fopen(timeline_path, "w");
+    if (timeline) fputs("time_us,block,interval\n", timeline);
+  }
+
+  // The bench drives the Stepper from here on
+  DISABLE_STEPPER_DRIVER_INTERRUPT();
+  running = true;
+
+  const uint64_t start_ns = nanos();
+  uint32_t lines = 0;
+  char line[256];
+  while (fgets(line, sizeof(line), in)) {
+    char *cmd = line;
+    char * const comment = strchr(cmd, ';');
+    if (comment) *comment = '\0';
+    while (*cmd == ' ' || *cmd == '\t') cmd++;
+    for (char *e = cmd + strlen(cmd); e > cmd && (ISEOL(e[-1]) || e[-1] == ' ' || e[-1] == '\t');) *--e = '\0';
+    if (!*cmd || skip_command(cmd)) continue;
+    if (strlen(cmd) >= MAX_CMD_SIZE) cmd[MAX_CMD_SIZE - 1] = '\0';
+    queue.enqueue_one_now(cmd);
+    queue.advance();
+    lines++;
+  }
+  fclose(in);
+
+  planner.synchronize();
+
+  const uint64_t host_ns = nanos() - start_ns;
+  running = false;
+
+  if (csv) fclose(csv);
+  if (timeline) fclose(timeline);
+
+  SERIAL_ECHOLNPGM("Replay: ", lines, " commands, ", blocks_done, " blocks, ",
+                   p_float_t(TICKS_TO_US(sim_ticks) / 1000000.0, 2), "s simulated in ",
+                   p_float_t(host_ns / 1e9, 2), "s");
+  if (blocks_done) {
+    SERIAL_ECHOLNPGM("Planner ns per block: avg ", uint32_t(plan_ns_total / blocks_done), " max ", plan_ns_max,
+                     " | recalculate avg ", uint32_t(recalc_ns_total / blocks_done), " max ", recalc_ns_max);
+    SERIAL_ECHOLNPGM("Stepper ISR: ", uint32_t(isr_calls_total), " calls, avg ",
+                     uint32_t(isr_ns_total / isr_calls_total), " ns");
+  }
+  exit(EXIT_SUCCESS);
+}
+
+#endif // REPLAY_BENCH
@@ -0,0 +1,67 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2024 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+#pragma once
+
+/**
+ * Planner / Stepper replay benchmark for the native simulator (env:simulator_linux_bench)
+ *
+ * Feeds a G-code file through GCodeQueue -> Planner -> Stepper. The Stepper ISR
+ * is run by the bench on simulated timer ticks instead of by the HAL timer, so
+ * a print can be replayed as fast as the host allows while the timing of every
+ * block stays what the printer would produce.
+ *
+ * One CSV row is written per block when it finishes stepping:
+ *   block       : Sequence number of the block
+ *   plan_ns     : Host time spent in Planner::_buffer_steps (incl. recalculate)
+ *   recalc_ns   : Host time spent in Planner::recalculate
+ *   queued      : Blocks in the planner right after this one was added
+ *   steps       : Step events in the block
+ *   start_us    : Simulated time when the Stepper started the block
+ *   end_us      : Simulated time when the block was finished
+ *   isr_calls   : Stepper ISR calls while the block was current
+ *   isr_ns      : Host time spent in those ISR calls
+ *
+ * Usage:
+ *   pio run -e simulator_linux_bench
+ *   MARLIN_REPLAY=print.gcode MARLIN_REPLAY_CSV=blocks.csv .pio/build/simulator_linux_bench/MarlinSimulator
+ *
+ * Set MARLIN_REPLAY_TIMELINE=isr.csv to also log every simulated ISR (time, block, interval).
+ */
+
+#include <stdint.h>
+
+class ReplayBench {
+public:
+  static bool running;                 // The bench is driving the Stepper ISR
+
+  static uint64_t nanos();             // Host monotonic time
+  static void run();                   // Replay the file, report, and exit
+  static void idle();                  // Step while the planner waits for room or for moves to finish
+
+  // Called by the planner once a block has been added
+  static void planned(const uint8_t index, const uint64_t start_ns, const uint64_t recalc_start_ns);
+
+private:
+  static void tick();                  // One simulated Stepper ISR
+};
+
+extern ReplayBench replayBench;
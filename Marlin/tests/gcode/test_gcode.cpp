@@ -56,3 +56,48 @@ MARLIN_TEST(gcode, parse_g1_nxz) {
   TEST_ASSERT_TRUE(parser.seen('Z'));
   TEST_ASSERT_FALSE(parser.seen('E'));
 }
+
+#if ENABLED(FASTER_GCODE_VALUES)
+
+// Parse "G1 X<value>" and check X against the C library conversions
+static void check_value(const char * const value) {
+  char current_command[32] = "G1 X";
+  strcat(current_command, value);
+  parser.parse(current_command);
+  TEST_ASSERT_TRUE(parser.seenval('X'));
+  const float f = parser.value_float(), ref = strtof(value, nullptr);
+  TEST_ASSERT_EQUAL_MEMORY_MESSAGE(&ref, &f, sizeof(f), value); // Bit for bit, so -0 isn't 0
+  TEST_ASSERT_EQUAL_INT32_MESSAGE(int32_t(strtol(value, nullptr, 10)), parser.value_long(), value);
+  TEST_ASSERT_EQUAL_UINT32_MESSAGE(uint32_t(strtoul(value, nullptr, 10)), parser.value_ulong(), value);
+}
+
+MARLIN_TEST(gcode, fast_values_decimals) {
+  for (const char *v : { ".5", "-.5", "+.5", "1.", "0.05", "1.05", "-0", "-0.0", "0.1", "-12.345", "-00001.50000" })
+    check_value(v);
+}
+
+MARLIN_TEST(gcode, fast_values_integers) {
+  for (const char *v : { "0", "7", "-7", "00000000012", "123456789", "-123456789", "1234567890", "-2147483648", "4294967295" })
+    check_value(v);
+
+  // Up to 9 digits are stored as a long, longer ones are read from the text
+  char current_command[] = "G1 X123456789 Y1234567890";
+  parser.parse(current_command);
+  TEST_ASSERT_TRUE(parser.seen('X'));
+  TEST_ASSERT_TRUE(parser.has_long_value());
+  TEST_ASSERT_TRUE(parser.seen('Y'));
+  TEST_ASSERT_FALSE(parser.has_long_value());
+  TEST_ASSERT_EQUAL_INT32(1234567890, parser.value_long());
+}
+
+MARLIN_TEST(gcode, fast_values_long_fractions) {
+  for (const char *v : { "0.0000000001", "3.1415926535", "0.12345678901", "1.00000000001", "3.14159265358" })
+    check_value(v);
+}
+
+MARLIN_TEST(gcode, fast_values_above_2_24) {
+  for (const char *v : { "16777216", "16777217", "-16777217", "33554433", "16777216.5", "16777217.0", "1677721.75", "99999999.9" })
+    check_value(v);
+}
+
+#endif
@@ -0,0 +1,92 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2024 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+
+#include "../test/unit_tests.h"
+
+#if ENABLED(DWIN_LCD_PROUI)
+
+#include <src/lcd/e3v2/proui/base64_stream.h>
+
+static const char b64chars[] = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+
+// Encode like a slicer thumbnail block: "; " prefixed comment lines of 78 characters
+static uint16_t encode_thumbnail(const uint8_t * const in, const uint16_t len, char * const out) {
+  uint16_t o = 0, col = 0;
+  auto put = [&](const char c) {
+    if (col == 0) { out[o++] = ';'; out[o++] = ' '; }
+    out[o++] = c;
+    if (++col == 78) { out[o++] = '\n'; col = 0; }
+  };
+  for (uint16_t i = 0; i < len; i += 3) {
+    const uint32_t n = uint32_t(in[i]) << 16 | (i + 1 < len ? uint32_t(in[i + 1]) << 8 : 0) | (i + 2 < len ? in[i + 2] : 0);
+    put(b64chars[(n >> 18) & 0x3F]);
+    put(b64chars[(n >> 12) & 0x3F]);
+    put(i + 1 < len ? b64chars[(n >> 6) & 0x3F] : '=');
+    put(i + 2 < len ? b64chars[n & 0x3F] : '=');
+  }
+  out[o++] = '\n';
+  return o;
+}
+
+MARLIN_TEST(base64_stream, decodes_large_thumbnail_in_small_chunks) {
+  // Larger than the RAM of many boards that could never hold it whole
+  static uint8_t image[12001], decoded[sizeof(image)];
+  static char text[sizeof(image) * 2];
+  uint32_t seed = 12345;
+  for (uint16_t i = 0; i < sizeof(image); ++i) { seed = seed * 1103515245 + 12345; image[i] = seed >> 16; }
+  const uint16_t textlen = encode_thumbnail(image, sizeof(image), text);
+
+  Base64Stream b64;
+  uint8_t chunk[128];
+  uint16_t got = 0;
+  for (uint16_t pos = 0; pos < textlen && !b64.done(); pos += sizeof(chunk)) {
+    const uint16_t n = _MIN(uint16_t(sizeof(chunk)), uint16_t(textlen - pos));
+    memcpy(chunk, text + pos, n);
+    const uint16_t len = b64.decode(chunk, n);
+    TEST_ASSERT_LESS_OR_EQUAL(n, len);
+    TEST_ASSERT_LESS_OR_EQUAL(sizeof(decoded), got + len);
+    memcpy(decoded + got, chunk, len);
+    got += len;
+  }
+
+  TEST_ASSERT_TRUE(b64.done());
+  TEST_ASSERT_EQUAL(sizeof(image), got);
+  TEST_ASSERT_EQUAL_UINT8_ARRAY(image, decoded, sizeof(image));
+
+  // Decoder state stays within a few bytes, independent of the image size
+  TEST_ASSERT_LESS_OR_EQUAL(4, sizeof(Base64Stream));
+}
+
+MARLIN_TEST(base64_stream, split_quantum_across_chunks) {
+  // "TWFu" => "Man", split mid-quantum
+  Base64Stream b64;
+  uint8_t a[] = { 'T', 'W' }, b[] = { 'F', 'u', '=' };
+  TEST_ASSERT_EQUAL(1, b64.decode(a, sizeof(a)));
+  TEST_ASSERT_EQUAL('M', a[0]);
+  TEST_ASSERT_EQUAL(2, b64.decode(b, sizeof(b)));
+  TEST_ASSERT_EQUAL('a', b[0]);
+  TEST_ASSERT_EQUAL('n', b[1]);
+  TEST_ASSERT_TRUE(b64.done());
+}
+
+#endif // DWIN_LCD_PROUI
@@ -0,0 +1,112 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2024 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "../test/unit_tests.h"
+#include <src/lcd/e3v2/common/dwin_queue.h>
+
+MARLIN_TEST(dwin_queue, push_pop_wraps_in_order) {
+  DWINTxQueue<64> q;
+  uint8_t in[48], out[48];
+  for (uint8_t n = 0; n < 48; ++n) in[n] = n;
+
+  // Move the indexes near the end of the buffer so the next push wraps
+  TEST_ASSERT_TRUE(q.push(in, 40));
+  TEST_ASSERT_EQUAL(40, q.pop(out, 40));
+  TEST_ASSERT_TRUE(q.isEmpty());
+
+  TEST_ASSERT_TRUE(q.push(in, 48));
+  TEST_ASSERT_EQUAL(48, q.used());
+  TEST_ASSERT_EQUAL(16, q.room());
+
+  // The first contiguous run stops at the end of the buffer
+  const uint8_t *run;
+  TEST_ASSERT_EQUAL(24, q.contiguous(run));
+
+  TEST_ASSERT_EQUAL(48, q.pop(out, sizeof(out)));
+  TEST_ASSERT_EQUAL_UINT8_ARRAY(in, out, 48);
+  TEST_ASSERT_TRUE(q.isEmpty());
+}
+
+MARLIN_TEST(dwin_queue, push_is_all_or_nothing) {
+  DWINTxQueue<64> q;
+  uint8_t in[64] = { 0 };
+  TEST_ASSERT_TRUE(q.push(in, 60));
+  TEST_ASSERT_FALSE(q.push(in, 5));
+  TEST_ASSERT_EQUAL(60, q.used());
+  TEST_ASSERT_TRUE(q.push(in, 4));
+  TEST_ASSERT_EQUAL(0, q.room());
+}
+
+#if ENABLED(DWIN_TX_QUEUE)
+
+#include <src/lcd/e3v2/common/dwin_api.h>
+
+// Queued packets must match the framing of the direct serial writes byte for byte
+static void check_queued(const uint8_t * const expected, const uint16_t len) {
+  uint8_t out[DWIN_TX_QUEUE_SIZE];
+  TEST_ASSERT_EQUAL(len, dwinTxQueue.used());
+  TEST_ASSERT_EQUAL(len, dwinTxQueue.pop(out, sizeof(out)));
+  TEST_ASSERT_EQUAL_UINT8_ARRAY(expected, out, len);
+}
+
+MARLIN_TEST(dwin_queue, frame_draw_line) {
+  dwinTxQueue.clear();
+  DWIN_Draw_Line(0x1234, 1, 2, 0x0103, 0x01E0);
+  const uint8_t expected[] = {
+    0xAA, 0x03, 0x12, 0x34, 0x00, 0x01, 0x00, 0x02, 0x01, 0x03, 0x01, 0xE0,
+    0xCC, 0x33, 0xC3, 0x3C
+  };
+  check_queued(expected, sizeof(expected));
+}
+
+MARLIN_TEST(dwin_queue, frame_draw_string) {
+  dwinTxQueue.clear();
+  DWIN_Draw_String(true, 2, 0xFFFF, 0x0000, 10, 20, "OK");
+  const uint8_t expected[] = {
+    0xAA, 0x11, 0x42, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x14, 'O', 'K',
+    0xCC, 0x33, 0xC3, 0x3C
+  };
+  check_queued(expected, sizeof(expected));
+}
+
+#if ENABLED(DWIN_LCD_PROUI)
+
+  #include <src/lcd/e3v2/proui/dwin_lcd.h>
+
+  MARLIN_TEST(dwin_queue, frame_write_to_mem_blocks) {
+    dwinTxQueue.clear();
+    uint8_t data[130];
+    for (uint8_t n = 0; n < sizeof(data); ++n) data[n] = n;
+    DWIN_WriteToMem(0x5A, 0x8000, sizeof(data), data);
+
+    // Two packets: 128 data bytes, then the remaining 2 at the next address
+    uint8_t expected[9 + 128 + 9 + 2], *p = expected;
+    const uint8_t head1[] = { 0xAA, 0x31, 0x5A, 0x80, 0x00 }, head2[] = { 0xAA, 0x31, 0x5A, 0x80, 0x80 },
+                  tail[] = { 0xCC, 0x33, 0xC3, 0x3C };
+    memcpy(p, head1, 5); p += 5; memcpy(p, data, 128); p += 128; memcpy(p, tail, 4); p += 4;
+    memcpy(p, head2, 5); p += 5; memcpy(p, data + 128, 2); p += 2; memcpy(p, tail, 4);
+    check_queued(expected, sizeof(expected));
+  }
+
+#endif
+
+#endif // DWIN_TX_QUEUE
@@ -0,0 +1,264 @@
+#!/usr/bin/env python3
+#
+# MarlinCompactMoves.py
+# Stream G-code to Marlin with the Compact Move Protocol (COMPACT_MOVE_PROTOCOL, M880).
+# G0/G1 moves are sent as small binary frames. Other commands are sent as G-code frames.
+#
+# Usage: MarlinCompactMoves.py [-b BAUD] [-w WINDOW] [-t TIMEOUT] PORT FILE
+#        MarlinCompactMoves.py --encode OUT FILE   (write frames to a file, no printer)
+#
+# See Marlin/src/feature/compact_moves.h for the frame format. The emergency
+# parser still acts on M108, M112, M410 and M876 sent as plain lines between frames, starting with '\n'.
+#
+import argparse, re, sys, time
+from collections import deque
+
+FRAME_START  = 0xFE
+FRAME_ESCAPE = 0xFD
+ESCAPE_XOR   = 0x20
+
+FIELD_X, FIELD_Y, FIELD_Z, FIELD_E, FIELD_F, ABSOLUTE_XYZ, ABSOLUTE_E, RAPID = range(8)
+QUERY, GCODE, EXIT = 0x00, 0x20, 0x40
+
+XYZ_SCALE = 1000     # Units per mm
+E_SCALE   = 100000
+
+def crc16(data):
+    crc = 0
+    for b in data:
+        crc ^= b << 8
+        for _ in range(8):
+            crc = ((crc << 1) ^ 0x1021) if crc & 0x8000 else crc << 1
+            crc &= 0xFFFF
+    return crc
+
+def varint(v):
+    out = bytearray()
+    while True:
+        b = v & 0x7F
+        v >>= 7
+        if v:
+            out.append(b | 0x80)
+        else:
+            out.append(b)
+            return out
+
+def zigzag(v):
+    return varint((v << 1) if v >= 0 else ((-v << 1) - 1))
+
+def frame(seq, ftype, data=b''):
+    body = bytes([seq & 0xFF, ftype, len(data)]) + bytes(data)
+    crc = crc16(body)
+    body += bytes([crc & 0xFF, crc >> 8])
+    out = bytearray([FRAME_START])
+    for b in body:
+        # Escape line ends too, so the emergency parser ignores the whole frame
+        if b >= FRAME_ESCAPE or b in (0x0A, 0x0D):
+            out += bytes([FRAME_ESCAPE, b ^ ESCAPE_XOR])
+        else:
+            out.append(b)
+    return bytes(out)
+
+class Converter(object):
+    '''
+    Turn G-code lines into (type, data) frames, tracking the positions the firmware
+    will have so moves can be sent as changes. Marlin reads positions back from
+    the machine after every G-code frame, so the next move after one sends X, Y, Z,
+    and (with M82) E as positions.
+    '''
+    move_re  = re.compile(r'^G0*([01])((?:\s*[XYZEF][-+]?(?:\d+\.?\d*|\.\d+))+)\s*$')
+    param_re = re.compile(r'([XYZEF])([-+]?(?:\d+\.?\d*|\.\d+))')
+
+    def __init__(self, max_data=95):
+        self.max_data = max_data
+        self.relative_xyz = False
+        self.relative_e = False
+        self.pos = [None] * 3  # Firmware X, Y, Z in units, or None after a G-code frame
+        self.e = None          # Firmware E in units with M82, or None after a G-code frame
+
+    def gcode_frame(self, line):
+        cmd = line.upper().split()
+        if cmd[0] == 'G90': self.relative_xyz = self.relative_e = False
+        elif cmd[0] == 'G91': self.relative_xyz = self.relative_e = True
+        elif cmd[0] == 'M82': self.relative_e = False
+        elif cmd[0] == 'M83': self.relative_e = True
+        self.pos = [None] * 3
+        self.e = None
+        data = line.encode('ascii')
+        if len(data) > self.max_data:
+            raise ValueError('Line too long for a G-code frame: ' + line)
+        return (GCODE, data)
+
+    def convert(self, line):
+        line = line.split(';', 1)[0].strip()
+        if not line: return None
+        m = self.move_re.match(line.upper())
+        if not m: return self.gcode_frame(line)
+
+        params = dict(self.param_re.findall(m.group(2)))
+        ftype = (1 << RAPID) if m.group(1) == '0' else 0
+        data = bytearray()
+
+        axes = [ i for i, a in enumerate('XYZ') if a in params ]
+        values = [ round(float(params['XYZ'[i]]) * XYZ_SCALE) for i in axes ]
+        absolute = not self.relative_xyz and any(self.pos[i] is None for i in axes)
+        if absolute: ftype |= 1 << ABSOLUTE_XYZ
+        for i, v in zip(axes, values):
+            ftype |= 1 << i
+            if absolute or self.relative_xyz:
+                data += zigzag(v)
+            else:
+                data += zigzag(v - self.pos[i])
+            if not self.relative_xyz:
+                self.pos[i] = v
+
+        if 'E' in params:
+            ftype |= 1 << FIELD_E
+            v = round(float(params['E']) * E_SCALE)
+            if self.relative_e:
+                data += zigzag(v)
+            elif self.e is None:
+                ftype |= 1 << ABSOLUTE_E
+                data += zigzag(v)
+            else:
+                data += zigzag(v - self.e)
+            if not self.relative_e:
+                self.e = v
+
+        if 'F' in params:
+            ftype |= 1 << FIELD_F
+            data += varint(max(0, round(float(params['F']))))
+
+        return (ftype, bytes(data))
+
+class CompactMoveStream(object):
+    '''
+    Send frames with a window of unacknowledged bytes, resending on "rs".
+    The oldest frame is sent again when no reply comes for a while, in case its "ok"
+    was lost. A printer busy in a long command doesn't read frames, so "busy:" lines
+    (HOST_KEEPALIVE_FEATURE) hold off resends, and each resend with no reply doubles
+    the wait, up to MAX_WAIT. Copies that pile up are acknowledged again once read.
+    '''
+    MAX_WAIT = 60
+    ok_re = re.compile(r'^ok(\d+)$')
+    rs_re = re.compile(r'^rs(\d+)$')
+
+    def __init__(self, port, baud, window, timeout):
+        import serial
+        self.serial = serial.Serial(port, baud, timeout=0.05, write_timeout=2)
+        self.window = window
+        self.timeout = timeout
+        self.wait = timeout       # Time without a reply before the next resend
+        self.last_reply = time.time()
+        self.seq = 0
+        self.unacked = deque()    # (seq, bytes)
+        self.in_flight = 0
+        self.buffer = b''
+        self.max_data = 95
+
+    def lines(self):
+        self.buffer += self.serial.read(self.serial.in_waiting or 1)
+        while b'\n' in self.buffer:
+            line, self.buffer = self.buffer.split(b'\n', 1)
+            yield line.decode('ascii', 'replace').strip()
+
+    def handle(self, line):
+        m = self.ok_re.match(line)
+        if m:
+            n = int(m.group(1))
+            # Cumulative: drop everything up to and including n
+            while self.unacked and ((n - self.unacked[0][0]) & 0xFF) < 0x80:
+                self.in_flight -= len(self.unacked.popleft()[1])
+            self.last_reply, self.wait = time.time(), self.timeout
+            return
+        m = self.rs_re.match(line)
+        if m:
+            n = int(m.group(1))
+            for s, f in self.unacked:
+                if ((s - n) & 0xFF) < 0x80: self.serial.write(f)
+            self.last_reply, self.wait = time.time(), self.timeout
+            return
+        if 'busy:' in line:
+            self.last_reply = time.time()
+        if line.startswith('cm'):
+            self.max_data = int(line[2:].split(',')[1])
+        if line: print(line)
+
+    def wait_ascii_ok(self):
+        while True:
+            for line in self.lines():
+                if line.startswith('ok'): return
+                print(line)
+
+    def poll(self):
+        for line in self.lines(): self.handle(line)
+        if self.unacked and time.time() - self.last_reply > self.wait:
+            self.serial.write(self.unacked[0][1])
+            self.last_reply = time.time()
+            self.wait = min(self.wait * 2, self.MAX_WAIT)
+
+    def send(self, ftype, data=b''):
+        f = frame(self.seq, ftype, data)
+        while self.unacked and self.in_flight + len(f) > self.window:
+            self.poll()
+        if not self.unacked: self.last_reply = time.time()
+        self.serial.write(f)
+        self.unacked.append((self.seq, f))
+        self.in_flight += len(f)
+        self.seq = (self.seq + 1) & 0xFF
+
+    def drain(self):
+        while self.unacked:
+            self.poll()
+
+    def start(self):
+        self.serial.write(b'M880 S1\n')
+        self.wait_ascii_ok()
+        self.send(QUERY)
+        self.drain()
+
+    def stop(self):
+        self.send(EXIT)
+        self.drain()
+
+def main():
+    parser = argparse.ArgumentParser(description='Stream G-code with the Marlin Compact Move Protocol')
+    parser.add_argument('-b', '--baud', type=int, default=250000)
+    parser.add_argument('-w', '--window', type=int, default=120, help='Bytes in flight. Keep below the RX buffer size.')
+    parser.add_argument('-t', '--timeout', type=float, default=3.0, help='Seconds without a reply before resending')
+    parser.add_argument('--encode', metavar='OUT', help='Write the frames to a file instead of a printer')
+    parser.add_argument('port', nargs='?')
+    parser.add_argument('file')
+    args = parser.parse_args()
+
+    conv = Converter()
+    with open(args.file) as f:
+        if args.encode:
+            seq, size, lines = 0, 0, 0
+            with open(args.encode, 'wb') as out:
+                for line in f:
+                    lines += 1
+                    fr = conv.convert(line)
+                    if fr is None: continue
+                    b = frame(seq, *fr)
+                    out.write(b)
+                    size += len(b)
+                    seq = (seq + 1) & 0xFF
+            print('%d lines to %d bytes' % (lines, size))
+            return
+
+        if not args.port: parser.error('PORT is required')
+        stream = CompactMoveStream(args.port, args.baud, args.window, args.timeout)
+        stream.start()
+        conv.max_data = stream.max_data
+        start = time.time()
+        try:
+            for line in f:
+                fr = conv.convert(line)
+                if fr is not None: stream.send(*fr)
+        finally:
+            stream.stop()
+        print('Done in %.1fs' % (time.time() - start))
+
+if __name__ == '__main__':
+    main()
@@ -3,8 +3,8 @@
 # MRiscoCProUI firmware
 # Miguel A. Risco-Castillo
 # ClassicRocker883
-# version: 2.2
-# date: 2024-05-25
+# version: 2.3
+# date: 2026-10-16
 #
 # Contains thumbnail code from:
 # https://github.com/Ultimaker/Cura/blob/master/plugins/PostProcessingPlugin/scripts/CreateThumbnail.py
@@ -12,6 +12,7 @@
 
 import base64
 import json
+import re
 from typing import Callable, TypeVar, Optional
 from enum import Enum, auto
 
@@ -226,4 +227,28 @@ class CreateJPEGThumbnail(Script):
                         break
                 data[layer_index] = "\n".join(lines)
 
+        self._insertProUIHeader(data, width, height)
         return data
+
+    # Fixed header for the firmware, read with a single read instead of searching the comments.
+    # TOFS assumes the layers are written as-is, with LF line endings. The firmware checks for
+    # the thumbnail block at TOFS and falls back to searching the comments if it isn't there.
+    def _insertProUIHeader(self, data, width, height):
+        def value(key):
+            match = re.search(key + r'\s*([-0-9.]+)', data[0])
+            return float(match[1]) if match is not None else 0
+
+        def header(tofs, tlen):
+            return (';PROUI_HEADER V1 TIME={:d} FIL={:.6f} LAYER={:.3f} MINX={:.3f} MINY={:.3f} MINZ={:.3f}'
+                    ' MAXX={:.3f} MAXY={:.3f} MAXZ={:.3f} TOFS={:010d} TLEN={:d}\n').format(
+                    int(value(';TIME:')), value(';Filament used:'), value(';Layer height:'),
+                    value(';MINX:'), value(';MINY:'), value(';MINZ:'),
+                    value(';MAXX:'), value(';MAXY:'), value(';MAXZ:'), tofs, tlen)
+
+        tofs = tlen = 0
+        body = "".join(data).encode("utf-8")
+        match = re.search(rb'; thumbnail begin %dx%d ([0-9]+)' % (width, height), body)
+        if match is not None:
+            tlen = int(match[1])
+            tofs = len(header(0, tlen).encode("utf-8")) + match.start()
+        data[0] = header(tofs, tlen) + data[0]
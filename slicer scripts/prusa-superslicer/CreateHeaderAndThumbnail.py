@@ -4,8 +4,8 @@
 # Orca / Prusa / Super Slicer post-processor script for the Professional Firmware
 # URL: https://github.com/mriscoc/Ender3V2S1
 # Miguel A. Risco-Castillo
-# version: 2.2
-# date: 2023/12/10
+# version: 2.3
+# date: 2026/10/16
 #
 # Contains code from the jpg re-encoder thumbnail post processor script:
 # github.com/alexqzd/Marlin/blob/Gcode-preview/Display%20firmware/gcode_thumb_to_jpg.py
@@ -108,25 +108,45 @@ totlc = float(match[1]) if match is not None else 0
 maxz = layer*totlc
 minz = 0
 
+#Fixed header for the firmware, read with a single read instead of searching the comments.
+#TOFS is the byte offset of the thumbnail block, filled in once the output is assembled.
+def proUIHeader(tofs, tlen):
+    return (';PROUI_HEADER V1 TIME={:d} FIL={:.6f} LAYER={:.3f} MINX={:.3f} MINY={:.3f} MINZ={:.3f}'
+            ' MAXX={:.3f} MAXY={:.3f} MAXZ={:.3f} TOFS={:010d} TLEN={:d}\n').format(
+            time, filament, layer, minx, miny, minz, maxx, maxy, maxz, tofs, tlen)
+
+#Legacy header values
+header = ''
+if ph is not None : header += ph[0]
+header += ';FLAVOR:Marlin\n'
+header += ';TIME:{:d}\n'.format(time)
+header += ';Filament used: {:.6f}\n'.format(filament)
+header += ';Layer height: {:.2f}\n'.format(layer)
+header += ';MINX:{:.3f}\n'.format(minx)
+header += ';MINY:{:.3f}\n'.format(miny)
+header += ';MINZ:{:.3f}\n'.format(minz)
+header += ';MAXX:{:.3f}\n'.format(maxx)
+header += ';MAXY:{:.3f}\n'.format(maxy)
+header += ';MAXZ:{:.3f}\n'.format(maxz)
+header += ';POSTPROCESSED\n'
+header += ';Header generated for the MRiscoCProUI Firmware\n'
+header += ';https://github.com/classicrocker883/MRiscoCProUI'
+
+#Point the fixed header at the 200x200 thumbnail, or the first one
+encoding = f.encoding
+body = (header + lines).encode(encoding)
+tofs = tlen = 0
+thumbs = list(re.finditer(rb'; thumbnail begin ([0-9]+)x([0-9]+) ([0-9]+)', body))
+if thumbs:
+    best = next((m for m in thumbs if m[1] == b'200' and m[2] == b'200'), thumbs[0])
+    tlen = int(best[3])
+    tofs = len(proUIHeader(0, tlen).encode(encoding)) + best.start()
+
 #Generate output file
 try:
-    with open(sourceFile, "w+") as of:
-    # Write header values
-        if ph is not None : of.write(ph[0])
-        of.write(';FLAVOR:Marlin\n')
-        of.write(';TIME:{:d}\n'.format(time))
-        of.write(';Filament used: {:.6f}\n'.format(filament))
-        of.write(';Layer height: {:.2f}\n'.format(layer))
-        of.write(';MINX:{:.3f}\n'.format(minx))
-        of.write(';MINY:{:.3f}\n'.format(miny))
-        of.write(';MINZ:{:.3f}\n'.format(minz))
-        of.write(';MAXX:{:.3f}\n'.format(maxx))
-        of.write(';MAXY:{:.3f}\n'.format(maxy))
-        of.write(';MAXZ:{:.3f}\n'.format(maxz))
-        of.write(';POSTPROCESSED\n')
-        of.write(';Header generated for the MRiscoCProUI Firmware\n')
-        of.write(';https://github.com/classicrocker883/MRiscoCProUI')
-        of.write(lines)
+    with open(sourceFile, "wb") as of:
+        of.write(proUIHeader(tofs, tlen).encode(encoding))
+        of.write(body)
 except:
     print('Error writing output file')
     input()